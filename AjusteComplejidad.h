@@ -0,0 +1,188 @@
+#ifndef AJUSTECOMPLEJIDAD_H
+#define AJUSTECOMPLEJIDAD_H
+
+#include <cmath>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ArnesBenchmark.h"
+
+// Ajuste empírico de complejidad: regresión por mínimos cuadrados de los valores medidos
+// (tiempos u operaciones) contra los modelos candidatos y = a + b·f(n), y una ley de
+// potencias y = c·n^k ajustada en escala log-log.
+
+enum class ModeloComplejidad {
+    Constante,    // 1
+    Logaritmico,  // log n
+    Lineal,       // n
+    Linearitmico, // n log n
+    Cuadratico    // n^2
+};
+
+const int numModelosComplejidad = 5;
+
+inline const char* nombreModelo(ModeloComplejidad modelo) {
+    switch (modelo) {
+        case ModeloComplejidad::Logaritmico: return "log n";
+        case ModeloComplejidad::Lineal: return "n";
+        case ModeloComplejidad::Linearitmico: return "n log n";
+        case ModeloComplejidad::Cuadratico: return "n^2";
+        default: return "1";
+    }
+}
+
+// f(n) de cada modelo
+inline double evaluarFuncion(ModeloComplejidad modelo, double n) {
+    switch (modelo) {
+        case ModeloComplejidad::Logaritmico: return std::log2(n);
+        case ModeloComplejidad::Lineal: return n;
+        case ModeloComplejidad::Linearitmico: return n * std::log2(n);
+        case ModeloComplejidad::Cuadratico: return n * n;
+        default: return 1;
+    }
+}
+
+struct AjusteModelo {
+    ModeloComplejidad modelo = ModeloComplejidad::Constante;
+    double a = 0;        // Término constante
+    double b = 0;        // Coeficiente de f(n)
+    double r2 = 0;       // Coeficiente de determinación
+    bool valido = false; // Falso si hay pocos puntos o el coeficiente sale negativo
+
+    double evaluar(double n) const { return a + b * evaluarFuncion(modelo, n); }
+};
+
+struct AjustePotencia {
+    double coeficiente = 0; // c
+    double exponente = 0;   // k
+    double r2 = 0;          // En escala log-log
+    bool valido = false;
+
+    double evaluar(double n) const { return coeficiente * std::pow(n, exponente); }
+};
+
+struct ResultadoAjuste {
+    std::vector<AjusteModelo> modelos; // Uno por modelo candidato, en el orden del enum
+    AjusteModelo mejor;                // Mayor R² entre los válidos (ver ajustarComplejidad)
+    AjustePotencia potencia;
+};
+
+// Regresión lineal simple y = a + b·x; devuelve false si x no varía
+inline bool regresionLineal(const std::vector<double>& x, const std::vector<double>& y, double& a, double& b, double& r2) {
+    size_t n = x.size();
+    if (n < 2) return false;
+    double mediaX = 0, mediaY = 0;
+    for (size_t i = 0; i < n; i++) {
+        mediaX += x[i];
+        mediaY += y[i];
+    }
+    mediaX /= n;
+    mediaY /= n;
+
+    double sxx = 0, sxy = 0, syy = 0;
+    for (size_t i = 0; i < n; i++) {
+        sxx += (x[i] - mediaX) * (x[i] - mediaX);
+        sxy += (x[i] - mediaX) * (y[i] - mediaY);
+        syy += (y[i] - mediaY) * (y[i] - mediaY);
+    }
+    if (sxx <= 0) return false;
+    b = sxy / sxx;
+    a = mediaY - b * mediaX;
+    r2 = syy > 0 ? (sxy * sxy) / (sxx * syy) : 1;
+    return true;
+}
+
+inline AjusteModelo ajustarModelo(const std::vector<double>& tamanos, const std::vector<double>& valores, ModeloComplejidad modelo) {
+    AjusteModelo ajuste;
+    ajuste.modelo = modelo;
+    if (tamanos.empty()) return ajuste;
+
+    if (modelo == ModeloComplejidad::Constante) {
+        double suma = 0;
+        for (double v : valores) suma += v;
+        ajuste.a = suma / valores.size();
+        double residual = 0;
+        for (double v : valores) residual += (v - ajuste.a) * (v - ajuste.a);
+        ajuste.r2 = residual == 0 ? 1 : 0; // La media no explica ninguna variación
+        ajuste.valido = true;
+        return ajuste;
+    }
+
+    std::vector<double> x;
+    for (double n : tamanos) x.push_back(evaluarFuncion(modelo, n));
+    ajuste.valido = regresionLineal(x, valores, ajuste.a, ajuste.b, ajuste.r2) && ajuste.b >= 0;
+    return ajuste;
+}
+
+// Ley de potencias: log y = log c + k·log n (solo puntos con n > 0 e y > 0)
+inline AjustePotencia ajustarPotencia(const std::vector<double>& tamanos, const std::vector<double>& valores) {
+    AjustePotencia ajuste;
+    std::vector<double> logN, logY;
+    for (size_t i = 0; i < tamanos.size() && i < valores.size(); i++) {
+        if (tamanos[i] <= 0 || valores[i] <= 0) continue;
+        logN.push_back(std::log(tamanos[i]));
+        logY.push_back(std::log(valores[i]));
+    }
+    double logC = 0;
+    ajuste.valido = regresionLineal(logN, logY, logC, ajuste.exponente, ajuste.r2);
+    ajuste.coeficiente = std::exp(logC);
+    return ajuste;
+}
+
+// Si ningún modelo creciente explica al menos esta fracción de la varianza, lo medido es
+// ruido alrededor de una constante y el mejor modelo es O(1)
+const double r2MinimoCreciente = 0.5;
+
+inline ResultadoAjuste ajustarComplejidad(const std::vector<double>& tamanos, const std::vector<double>& valores) {
+    ResultadoAjuste resultado;
+    for (int m = 0; m < numModelosComplejidad; m++) {
+        resultado.modelos.push_back(ajustarModelo(tamanos, valores, static_cast<ModeloComplejidad>(m)));
+        const AjusteModelo& ajuste = resultado.modelos.back();
+        if (ajuste.valido && (!resultado.mejor.valido || ajuste.r2 > resultado.mejor.r2)) resultado.mejor = ajuste;
+    }
+    if (resultado.mejor.valido && resultado.mejor.r2 < r2MinimoCreciente) resultado.mejor = resultado.modelos.front();
+    resultado.potencia = ajustarPotencia(tamanos, valores);
+    return resultado;
+}
+
+// Ajuste de las medianas de las celdas del arnés
+inline ResultadoAjuste ajustarComplejidad(const std::vector<int>& tamanos, const std::vector<EstadisticasCelda>& celdas) {
+    std::vector<double> x, y;
+    for (size_t i = 0; i < tamanos.size() && i < celdas.size(); i++) {
+        x.push_back(tamanos[i]);
+        y.push_back(celdas[i].mediana);
+    }
+    return ajustarComplejidad(x, y);
+}
+
+// Fórmula del ajuste con sus constantes, por ejemplo "120 + 3.41·n log n"
+inline std::string describirAjuste(const AjusteModelo& ajuste) {
+    std::ostringstream texto;
+    texto.precision(3);
+    if (ajuste.modelo == ModeloComplejidad::Constante) {
+        texto << ajuste.a;
+    } else {
+        texto << ajuste.a << " + " << ajuste.b << "·" << nombreModelo(ajuste.modelo);
+    }
+    return texto.str();
+}
+
+inline void imprimirAjuste(std::ostream& salida, const char* caso, const ResultadoAjuste& resultado) {
+    salida << "Ajuste " << caso << ":";
+    for (const AjusteModelo& ajuste : resultado.modelos) {
+        salida << "\tO(" << nombreModelo(ajuste.modelo) << ") R2=";
+        if (ajuste.valido) salida << ajuste.r2; else salida << "-";
+    }
+    salida << std::endl;
+    if (resultado.mejor.valido) {
+        salida << "  Mejor: O(" << nombreModelo(resultado.mejor.modelo) << ")  y = " << describirAjuste(resultado.mejor)
+               << "  R2=" << resultado.mejor.r2 << std::endl;
+    }
+    if (resultado.potencia.valido) {
+        salida << "  Potencia: y = " << resultado.potencia.coeficiente << "·n^" << resultado.potencia.exponente
+               << "  R2(log-log)=" << resultado.potencia.r2 << std::endl;
+    }
+}
+
+#endif // AJUSTECOMPLEJIDAD_H
@@ -0,0 +1,227 @@
+#ifndef ALMACENRESULTADOS_H
+#define ALMACENRESULTADOS_H
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "ArnesBenchmark.h"
+#include "Estadisticas.h"
+
+// Almacén de resultados para detectar regresiones entre versiones: un archivo de texto al que
+// solo se agregan líneas, una por celda, separadas por tabuladores:
+//
+//   fecha  commit  compilador  banderas  cpu  algoritmo  caso  n  ns1,ns2,...
+//
+// Una "versión" es la combinación (commit, compilador, banderas, cpu); solo tiene sentido
+// comparar versiones medidas en la misma CPU.
+
+// DIRECTORIO_FUENTE y BANDERAS_COMPILACION los define CMake
+#ifndef DIRECTORIO_FUENTE
+#define DIRECTORIO_FUENTE "."
+#endif
+#ifndef BANDERAS_COMPILACION
+#define BANDERAS_COMPILACION "desconocidas"
+#endif
+
+struct EntornoMedicion {
+    std::string commit;
+    std::string compilador;
+    std::string banderas;
+    std::string cpu;
+
+    std::string clave() const { return commit + " | " + compilador + " | " + banderas + " | " + cpu; }
+    bool operator==(const EntornoMedicion& otro) const { return clave() == otro.clave(); }
+};
+
+struct RegistroAlmacen {
+    std::string fecha;
+    EntornoMedicion entorno;
+    std::string algoritmo;
+    std::string caso;
+    int n = 0;
+    std::vector<double> muestras; // Nanosegundos
+};
+
+// Salida de un comando (sin el salto de línea final); vacía si falla
+inline std::string salidaComando(const std::string& comando) {
+    std::string salida;
+    FILE* tuberia = popen(comando.c_str(), "r");
+    if (!tuberia) return salida;
+    char bufer[256];
+    while (fgets(bufer, sizeof(bufer), tuberia)) salida += bufer;
+    if (pclose(tuberia) != 0) return "";
+    while (!salida.empty() && (salida.back() == '\n' || salida.back() == '\r')) salida.pop_back();
+    return salida;
+}
+
+// Los campos no pueden contener tabuladores ni saltos de línea
+inline std::string limpiarCampo(std::string texto) {
+    for (char& c : texto) {
+        if (c == '\t' || c == '\n' || c == '\r') c = ' ';
+    }
+    return texto.empty() ? "-" : texto;
+}
+
+// Entorno del binario en ejecución: commit del árbol fuente (con -dirty si tiene cambios sin
+// confirmar), versión del compilador, banderas de compilación y modelo de CPU
+inline EntornoMedicion entornoActual() {
+    EntornoMedicion entorno;
+    entorno.commit = salidaComando("git -C \"" DIRECTORIO_FUENTE "\" describe --always --dirty 2>/dev/null");
+    if (entorno.commit.empty()) entorno.commit = "desconocido";
+#if defined(__clang__)
+    entorno.compilador = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    entorno.compilador = std::string("gcc ") + __VERSION__;
+#else
+    entorno.compilador = "desconocido";
+#endif
+    entorno.banderas = BANDERAS_COMPILACION;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string linea;
+    while (std::getline(cpuinfo, linea)) {
+        if (linea.rfind("model name", 0) == 0) {
+            entorno.cpu = linea.substr(linea.find(':') + 2);
+            break;
+        }
+    }
+    if (entorno.cpu.empty()) entorno.cpu = "desconocida";
+    for (std::string* campo : {&entorno.commit, &entorno.compilador, &entorno.banderas, &entorno.cpu}) *campo = limpiarCampo(*campo);
+    return entorno;
+}
+
+// Agrega celdas al final del archivo; seguro desde varios hilos
+class AlmacenResultados {
+public:
+    AlmacenResultados(const std::string& ruta, const EntornoMedicion& entorno) : archivo(ruta, std::ios::app), entorno(entorno) {
+        std::time_t ahora = std::time(nullptr);
+        char texto[32];
+        std::strftime(texto, sizeof(texto), "%Y-%m-%dT%H:%M:%S", std::localtime(&ahora));
+        fecha = texto;
+    }
+
+    bool abierto() const { return static_cast<bool>(archivo); }
+
+    void agregar(const std::string& algoritmo, const std::string& caso, int n, const EstadisticasCelda& celda) {
+        std::lock_guard<std::mutex> candado(mutex);
+        archivo << fecha << "\t" << entorno.commit << "\t" << entorno.compilador << "\t" << entorno.banderas << "\t" << entorno.cpu
+                << "\t" << limpiarCampo(algoritmo) << "\t" << limpiarCampo(caso) << "\t" << n << "\t";
+        for (size_t i = 0; i < celda.muestras.size(); i++) {
+            archivo << (i ? "," : "");
+            // Con lotes la muestra es un promedio por operación y puede ser menor que 1 ns
+            if (celda.lote > 1) archivo << celda.muestras[i];
+            else archivo << static_cast<long long>(celda.muestras[i]);
+        }
+        archivo << "\n";
+        archivo.flush();
+    }
+
+private:
+    std::ofstream archivo;
+    EntornoMedicion entorno;
+    std::string fecha;
+    std::mutex mutex;
+};
+
+// Lee todo el almacén en el orden del archivo; las líneas mal formadas se ignoran
+inline std::vector<RegistroAlmacen> leerAlmacen(const std::string& ruta) {
+    std::vector<RegistroAlmacen> registros;
+    std::ifstream archivo(ruta);
+    std::string linea;
+    while (std::getline(archivo, linea)) {
+        std::vector<std::string> campos;
+        std::stringstream flujo(linea);
+        std::string campo;
+        while (std::getline(flujo, campo, '\t')) campos.push_back(campo);
+        if (campos.size() != 9) continue;
+
+        RegistroAlmacen registro;
+        registro.fecha = campos[0];
+        registro.entorno = {campos[1], campos[2], campos[3], campos[4]};
+        registro.algoritmo = campos[5];
+        registro.caso = campos[6];
+        registro.n = std::atoi(campos[7].c_str());
+        std::stringstream muestras(campos[8]);
+        while (std::getline(muestras, campo, ',')) {
+            if (!campo.empty()) registro.muestras.push_back(std::atof(campo.c_str()));
+        }
+        if (registro.n > 0 && !registro.muestras.empty()) registros.push_back(std::move(registro));
+    }
+    return registros;
+}
+
+// Versiones distintas en el orden en que aparecen por primera vez (orden cronológico)
+inline std::vector<EntornoMedicion> versionesAlmacen(const std::vector<RegistroAlmacen>& registros) {
+    std::vector<EntornoMedicion> versiones;
+    for (const RegistroAlmacen& registro : registros) {
+        if (std::find(versiones.begin(), versiones.end(), registro.entorno) == versiones.end()) versiones.push_back(registro.entorno);
+    }
+    return versiones;
+}
+
+using ClaveCelda = std::tuple<std::string, std::string, int>; // (algoritmo, caso, n)
+
+// Muestras de una versión agrupadas por celda; si la celda se midió varias veces en la misma
+// versión, se juntan todas las muestras
+inline std::map<ClaveCelda, std::vector<double>> muestrasDeVersion(const std::vector<RegistroAlmacen>& registros, const EntornoMedicion& version) {
+    std::map<ClaveCelda, std::vector<double>> celdas;
+    for (const RegistroAlmacen& registro : registros) {
+        if (!(registro.entorno == version)) continue;
+        std::vector<double>& muestras = celdas[{registro.algoritmo, registro.caso, registro.n}];
+        muestras.insert(muestras.end(), registro.muestras.begin(), registro.muestras.end());
+    }
+    return celdas;
+}
+
+struct ComparacionCelda {
+    ClaveCelda celda;
+    double medianaBase = 0;
+    double medianaNueva = 0;
+    double cambioRelativo = 0; // (nueva - base) / base
+    PruebaMannWhitney prueba;
+    bool regresion = false;
+    bool mejora = false;
+    bool insuficiente = false; // Con estas muestras la prueba no puede llegar a p < alfa
+};
+
+// Una celda es regresión (o mejora) si la prueba de Mann-Whitney es significativa al nivel
+// alfa y la mediana cambió al menos el umbral relativo, para no marcar diferencias
+// estadísticamente reales pero despreciables. Si ni el caso más extremo llega a p < alfa (p. ej.
+// 4 contra 4 muestras con alfa 0.01), la celda se marca como insuficiente en vez de pasar
+inline ComparacionCelda compararMuestras(const std::vector<double>& muestrasBase, const std::vector<double>& muestrasNuevas,
+                                         double alfa = 0.01, double umbral = 0.05) {
+    ComparacionCelda comparacion;
+    comparacion.medianaBase = mediana(muestrasBase);
+    comparacion.medianaNueva = mediana(muestrasNuevas);
+    comparacion.cambioRelativo = comparacion.medianaBase > 0 ? comparacion.medianaNueva / comparacion.medianaBase - 1 : 0;
+    comparacion.prueba = pruebaMannWhitney(muestrasBase, muestrasNuevas);
+    comparacion.insuficiente = comparacion.prueba.pMinimo >= alfa;
+    bool significativa = comparacion.prueba.p < alfa;
+    comparacion.regresion = significativa && comparacion.prueba.efecto > 0 && comparacion.cambioRelativo >= umbral;
+    comparacion.mejora = significativa && comparacion.prueba.efecto < 0 && comparacion.cambioRelativo <= -umbral;
+    return comparacion;
+}
+
+// Compara las celdas medidas en ambas versiones
+inline std::vector<ComparacionCelda> compararVersiones(const std::vector<RegistroAlmacen>& registros, const EntornoMedicion& base,
+                                                       const EntornoMedicion& nueva, double alfa = 0.01, double umbral = 0.05) {
+    std::vector<ComparacionCelda> comparaciones;
+    std::map<ClaveCelda, std::vector<double>> celdasBase = muestrasDeVersion(registros, base);
+    std::map<ClaveCelda, std::vector<double>> celdasNuevas = muestrasDeVersion(registros, nueva);
+    for (const auto& [clave, muestrasBase] : celdasBase) {
+        auto encontrada = celdasNuevas.find(clave);
+        if (encontrada == celdasNuevas.end()) continue;
+        comparaciones.push_back(compararMuestras(muestrasBase, encontrada->second, alfa, umbral));
+        comparaciones.back().celda = clave;
+    }
+    return comparaciones;
+}
+
+#endif // ALMACENRESULTADOS_H
@@ -0,0 +1,96 @@
+#ifndef ARBOLBUSQUEDA_H
+#define ARBOLBUSQUEDA_H
+
+#include <cstdint>
+#include <utility>   // Para std::exchange
+#include <vector>
+#include "GeneradoresEntrada.h" // Orden de inserción reproducible
+#include "PoliticaConteo.h"     // Conteo de visitas, comparaciones y asignaciones
+
+// Árbol binario de búsqueda y generadores de sus casos, compartidos por la versión
+// gráfica (BinarySearch.cpp) y la de consola (BenchmarkConsola.cpp)
+
+// Definición de un nodo para el árbol binario de búsqueda (BST)
+struct Nodo {
+    int valor;
+    Nodo* izquierda;
+    Nodo* derecha;
+
+    Nodo(int v) : valor(v), izquierda(nullptr), derecha(nullptr) {}
+};
+
+// Inserta un nuevo valor en el árbol BST
+template <class Politica = ConteoNulo>
+Nodo* insertar(Nodo* raiz, int valor) {
+    if (!raiz) {
+        Politica::asignacion();
+        return new Nodo(valor);
+    }
+    Politica::visita();
+    Politica::comparacion();
+    if (valor < raiz->valor) {
+        raiz->izquierda = insertar<Politica>(raiz->izquierda, valor);
+    } else {
+        raiz->derecha = insertar<Politica>(raiz->derecha, valor);
+    }
+    return raiz;
+}
+
+// Libera todos los nodos del árbol (iterativo: el árbol degenerado tiene profundidad n)
+inline void liberarArbol(Nodo* raiz) {
+    std::vector<Nodo*> pendientes;
+    if (raiz) pendientes.push_back(raiz);
+    while (!pendientes.empty()) {
+        Nodo* nodo = pendientes.back();
+        pendientes.pop_back();
+        if (nodo->izquierda) pendientes.push_back(nodo->izquierda);
+        if (nodo->derecha) pendientes.push_back(nodo->derecha);
+        delete nodo;
+    }
+}
+
+// Árbol dueño de sus nodos, para que el arnés lo libere fuera de la región medida
+struct ArbolBST {
+    Nodo* raiz;
+
+    explicit ArbolBST(Nodo* r) : raiz(r) {}
+    ArbolBST(ArbolBST&& otro) noexcept : raiz(std::exchange(otro.raiz, nullptr)) {}
+    ~ArbolBST() { liberarArbol(raiz); }
+};
+
+// Genera un árbol BST balanceado (la semilla fija el orden de inserción)
+inline Nodo* generarBSTBalanceado(int n, uint64_t semilla) {
+    Nodo* raiz = nullptr;
+    for (int v : generarCasoPromedio(n, semilla)) {
+        raiz = insertar(raiz, v);
+    }
+    return raiz;
+}
+
+inline Nodo* generarBSTBalanceado(int n) {
+    return generarBSTBalanceado(n, semillaEntradas);
+}
+
+// Genera un BST en el peor caso (desequilibrado)
+inline Nodo* generarBSTPeorCaso(int n) {
+    Nodo* raiz = nullptr;
+    for (int i = 0; i < n; ++i) {
+        raiz = insertar(raiz, i);
+    }
+    return raiz;
+}
+
+// Genera un BST en el caso promedio (la semilla fija el orden de inserción)
+inline Nodo* generarBSTCasoPromedio(int n, uint64_t semilla) {
+    Nodo* raiz = nullptr;
+    for (int v : generarCasoPromedio(n, semilla)) {
+        raiz = insertar(raiz, v);
+    }
+    return raiz;
+}
+
+inline Nodo* generarBSTCasoPromedio(int n) {
+    return generarBSTCasoPromedio(n, semillaEntradas);
+}
+
+#endif // ARBOLBUSQUEDA_H
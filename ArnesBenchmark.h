@@ -0,0 +1,294 @@
+#ifndef ARNESBENCHMARK_H
+#define ARNESBENCHMARK_H
+
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ContadorHardware.h"
+#include "EstadoCache.h"
+#include "Estadisticas.h"
+#include "MedicionMemoria.h"
+#include "PaginasMemoria.h"
+#include "RelojCiclos.h"
+#include "Trazas.h"
+
+// Arnés de repeticiones para medir una celda (algoritmo, tamaño, caso):
+//  - iteraciones de calentamiento que no se registran,
+//  - repeticiones adaptativas hasta que el intervalo de confianza de la mediana sea angosto
+//    (o se agote el presupuesto de tiempo de la celda),
+//  - la entrada se prepara (copia fresca) y se destruye fuera de la región medida,
+//  - la región se cronometra con RelojCiclos (TSC serializado y calibrado) descontando el
+//    sobrecosto de la lectura; las operaciones más cortas que loteMinimoNs se ejecutan en lotes
+//    (con una entrada preparada para cada una) y la muestra es el tiempo del lote / su tamaño,
+//  - la región medida se envuelve con el grupo de contadores de hardware (si están permitidos)
+//    y con una región de memoria (reservas, pico de bytes vivos y de RSS, fallos de página),
+//  - opcionalmente se verifica el resultado de la primera corrida, fuera de la medición,
+//  - antes de cada muestra las cachés y la TLB se dejan en el estado pedido (EstadoCache.h),
+//  - lo que reservan preparar() y la operación sale de una arena de páginas de 4 KiB o 2 MiB
+//    (PaginasMemoria.h) si se pidió; las reservas del arnés mismo siempre salen de malloc.
+// Las fases (copiar, estadoCache, medir, verificar) son zonas de traza (Trazas.h).
+
+struct ConfiguracionArnes {
+    int calentamiento = 1;
+    int repeticionesMinimas = 5;
+    int repeticionesMaximas = 30;
+    double anchoRelativoMaximo = 0.05;      // Ancho del IC 95% / mediana para detenerse
+    long long presupuestoNs = 3000000000LL; // Tiempo total por celda, incluida la preparación
+    bool contadoresHardware = true;
+    bool memoria = true; // Reservas solo si el programa incluye GanchosMemoria.h
+    double loteMinimoNs = 10000; // Duración mínima de una muestra; 0: sin lotes
+    long long loteMaximo = 1 << 20;
+    EstadoCache estadoCache = EstadoCache::Actual; // En los modos fríos no hay lotes
+    // Arena de la celda; lo que preparar() reserve tiene que liberarse dentro de la celda.
+    // Requiere GanchosMemoria.h
+    TipoPaginas paginas = TipoPaginas::Sistema;
+};
+
+struct EstadisticasCelda {
+    std::vector<double> muestras; // Nanosegundos, en orden de ejecución
+    double mediana = 0;
+    double p05 = 0;
+    double p95 = 0;
+    double mad = 0;
+    IntervaloConfianza intervalo{0, 0};
+    LecturaContadores contadores; // Mediana por evento de las repeticiones
+    std::vector<LecturaContadores> lecturas; // Una por repetición (vacío si no hubo contadores)
+    LecturaMemoria memoria; // Mediana por métrica de las repeticiones
+    std::vector<LecturaMemoria> lecturasMemoria; // Una por repetición (vacío si no se midió)
+    int nucleo = -1; // CPU donde corrió la celda, si el planificador la fijó
+    long long lote = 1; // Operaciones por muestra; muestras, contadores y reservas son por operación
+    bool resultadoCorrecto = true; // Falso si la verificación del resultado falló
+};
+
+// Reloj del arnés en nanosegundos
+inline long long relojArnesNs() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Impide que el compilador elimine un resultado que no se usa después de la medición
+template <class T>
+inline void evitarOptimizacion(const T& valor) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(valor) : "memory");
+#else
+    static volatile const void* sumidero;
+    sumidero = &valor;
+#endif
+}
+
+inline EstadisticasCelda resumirMuestras(std::vector<double> muestras) {
+    EstadisticasCelda celda;
+    celda.mediana = mediana(muestras);
+    celda.p05 = percentil(muestras, 0.05);
+    celda.p95 = percentil(muestras, 0.95);
+    celda.mad = desviacionAbsolutaMediana(muestras);
+    celda.intervalo = intervaloBootstrapMediana(muestras);
+    celda.muestras = std::move(muestras);
+    return celda;
+}
+
+// Tamaño de lote para que una muestra dure al menos loteMinimoNs, dada la duración de una
+// operación suelta (medida en el calentamiento)
+inline long long elegirLote(double operacionNs, const ConfiguracionArnes& configuracion) {
+    if (configuracion.loteMinimoNs <= 0 || operacionNs >= configuracion.loteMinimoNs) return 1;
+    double operacion = std::max(operacionNs, relojCiclos().resolucionNs());
+    return std::clamp(static_cast<long long>(std::ceil(configuracion.loteMinimoNs / operacion)), 1LL, std::max(1LL, configuracion.loteMaximo));
+}
+
+// Deja las cachés y la TLB en el estado pedido con las entradas de la muestra ya preparadas
+// (el modo caliente se prepara antes, en medirCeldaVerificada)
+template <class Entrada>
+void fijarEstadoCache(EstadoCache estado, Entrada* entradas, size_t cantidad) {
+    if (estado != EstadoCache::Frio && estado != EstadoCache::FrioTLB) return;
+    ZONA_TRAZA("estadoCache");
+    if (estado == EstadoCache::FrioTLB) {
+        evitarOptimizacion(expulsarTLB());
+        return;
+    }
+    evitarOptimizacion(expulsarCaches());
+    if constexpr (requires(Entrada& entrada) { std::data(entrada); std::size(entrada); }) {
+        for (size_t i = 0; i < cantidad; i++) vaciarLineas(std::data(entradas[i]), std::size(entradas[i]) * sizeof(*std::data(entradas[i])));
+    }
+}
+
+// Lecturas de un lote divididas entre sus operaciones (los picos de memoria no se dividen)
+inline void dividirPorLote(LecturaContadores& lectura, LecturaMemoria& memoria, long long lote) {
+    if (lote <= 1) return;
+    for (long long& valor : lectura.valores) {
+        if (valor >= 0) valor /= lote;
+    }
+    for (int m : {MemoriaAsignaciones, MemoriaBytes, MemoriaFallosPagina}) {
+        if (memoria.disponible(m)) memoria.valores[m] /= lote;
+    }
+}
+
+// preparar() devuelve la entrada de una repetición (un valor nuevo o una referencia si la
+// operación no la modifica); operacion(entrada) es lo único que queda dentro del cronómetro.
+// Con lotes, si preparar() devuelve un valor se prepara una entrada por operación; si devuelve
+// una referencia, el lote repite la operación sobre la misma entrada (ya en caché).
+// verificar(entrada) revisa el resultado de la primera corrida (p. ej. que quedó ordenada).
+// En el estado caliente, si preparar() devuelve una referencia, la pasada previa es sobre la
+// misma entrada: la operación no debe modificarla.
+template <class Preparar, class Operacion, class Verificar>
+EstadisticasCelda medirCeldaVerificada(Preparar&& preparar, Operacion&& operacion, Verificar&& verificar, const ConfiguracionArnes& configuracion = {}) {
+    ZONA_TRAZA("medirCelda");
+    using Entrada = decltype(preparar());
+    RelojCiclos& reloj = relojCiclos();
+    long long inicioCelda = relojArnesNs();
+    auto agotado = [&] { return relojArnesNs() - inicioCelda >= configuracion.presupuestoNs; };
+    bool correcto = true, verificado = false;
+
+    // La arena está en uso solo al preparar y en la región medida
+    ArenaPaginas arena(configuracion.paginas);
+    UsarArena sinArena(nullptr);
+    auto prepararEnArena = [&]() -> decltype(auto) {
+        UsarArena usar(arena);
+        return preparar();
+    };
+    auto calentarEnArena = [&](auto& entrada) {
+        UsarArena usar(arena);
+        operacion(entrada);
+    };
+
+    // Prepara las entradas de un lote de k operaciones y llama medir(ejecutarLote); después de
+    // la primera corrida verifica el resultado
+    auto conLote = [&](long long k, auto&& medir) {
+        if constexpr (std::is_lvalue_reference_v<Entrada>) {
+            Entrada entrada = prepararEnArena();
+            if (configuracion.estadoCache == EstadoCache::Caliente) calentarEnArena(entrada);
+            fijarEstadoCache(configuracion.estadoCache, std::addressof(entrada), 1);
+            medir([&] {
+                for (long long i = 0; i < k; i++) operacion(entrada);
+            });
+            if (!verificado) {
+                ZONA_TRAZA("verificar");
+                correcto = verificar(entrada);
+                verificado = true;
+            }
+        } else {
+            if (configuracion.estadoCache == EstadoCache::Caliente) {
+                auto previa = prepararEnArena();
+                calentarEnArena(previa);
+            }
+            std::vector<std::remove_cv_t<Entrada>> entradas;
+            entradas.reserve(k);
+            {
+                ZONA_TRAZA("copiar");
+                for (long long i = 0; i < k; i++) entradas.push_back(prepararEnArena());
+            }
+            fijarEstadoCache(configuracion.estadoCache, entradas.data(), entradas.size());
+            medir([&] {
+                for (auto& entrada : entradas) operacion(entrada);
+            });
+            if (!verificado) {
+                ZONA_TRAZA("verificar");
+                correcto = verificar(entradas.front());
+                verificado = true;
+            }
+        }
+    };
+    auto cronometrar = [&](auto&& ejecutarLote) {
+        ZONA_TRAZA("medir");
+        UsarArena usar(arena);
+        uint64_t desde = reloj.inicio();
+        ejecutarLote();
+        return reloj.duracionNs(desde, reloj.fin());
+    };
+
+    // Sin calentamiento igual se corre una vez, sin registrarla, para elegir el lote
+    double operacionNs = -1;
+    int calentamiento = configuracion.loteMinimoNs > 0 ? std::max(1, configuracion.calentamiento) : configuracion.calentamiento;
+    for (int i = 0; i < calentamiento && (i == 0 || !agotado()); i++) {
+        conLote(1, [&](auto&& ejecutarLote) {
+            double ns = cronometrar(ejecutarLote);
+            operacionNs = operacionNs < 0 ? ns : std::min(operacionNs, ns);
+        });
+    }
+    // Una corrida suelta de una operación muy corta es ruidosa: el lote se corrige midiendo
+    // lotes de prueba hasta que el tamaño se estabilice
+    bool frio = configuracion.estadoCache == EstadoCache::Frio || configuracion.estadoCache == EstadoCache::FrioTLB;
+    long long lote = frio ? 1 : elegirLote(operacionNs, configuracion);
+    for (int intento = 0; intento < 4 && lote > 1; intento++) {
+        long long siguiente = lote;
+        conLote(lote, [&](auto&& ejecutarLote) { siguiente = elegirLote(cronometrar(ejecutarLote) / lote, configuracion); });
+        if (siguiente == lote || (siguiente < lote && siguiente * 2 > lote)) break;
+        lote = siguiente;
+    }
+
+    GrupoContadores grupo;
+    bool medirContadores = configuracion.contadoresHardware && grupo.disponible();
+    std::vector<LecturaContadores> lecturas;
+    RegionMemoria regionMemoria;
+    std::vector<LecturaMemoria> lecturasMemoria;
+    std::vector<double> muestras;
+
+    while (static_cast<int>(muestras.size()) < configuracion.repeticionesMaximas) {
+        conLote(lote, [&](auto&& ejecutarLote) {
+            if (configuracion.memoria) regionMemoria.iniciar();
+            if (medirContadores) grupo.iniciar();
+            double ns = cronometrar(ejecutarLote);
+            LecturaContadores lectura;
+            LecturaMemoria memoria;
+            if (medirContadores) {
+                grupo.detener();
+                lectura = grupo.leer();
+            }
+            if (configuracion.memoria) memoria = regionMemoria.detener();
+            dividirPorLote(lectura, memoria, lote);
+            if (medirContadores) lecturas.push_back(lectura);
+            if (configuracion.memoria) lecturasMemoria.push_back(memoria);
+            muestras.push_back(ns / lote);
+        });
+
+        if (agotado()) break;
+        if (static_cast<int>(muestras.size()) >= configuracion.repeticionesMinimas) {
+            // Durante el ciclo basta un bootstrap reducido; el resumen final usa el completo
+            IntervaloConfianza intervalo = intervaloBootstrapMediana(muestras, 200);
+            double centro = mediana(muestras);
+            if (centro > 0 && (intervalo.superior - intervalo.inferior) / centro <= configuracion.anchoRelativoMaximo) break;
+        }
+    }
+    EstadisticasCelda celda = resumirMuestras(std::move(muestras));
+    celda.contadores = medianaContadores(lecturas);
+    celda.lecturas = std::move(lecturas);
+    celda.memoria = medianaMemoria(lecturasMemoria);
+    celda.lecturasMemoria = std::move(lecturasMemoria);
+    celda.lote = lote;
+    celda.resultadoCorrecto = correcto;
+    return celda;
+}
+
+template <class Preparar, class Operacion>
+EstadisticasCelda medirCelda(Preparar&& preparar, Operacion&& operacion, const ConfiguracionArnes& configuracion = {}) {
+    return medirCeldaVerificada(std::forward<Preparar>(preparar), std::forward<Operacion>(operacion), [](const auto&) { return true; }, configuracion);
+}
+
+// Una línea por celda: repeticiones (x operaciones por lote), mediana, p95, MAD e IC 95% de la
+// mediana y, si hay contadores, IPC y fallos por elemento (-1 para los eventos no disponibles)
+// y, si se midió, la memoria
+inline void imprimirCelda(std::ostream& salida, const char* caso, int n, const EstadisticasCelda& celda) {
+    salida << caso << "\tn=" << n << "\trep=" << celda.muestras.size();
+    if (celda.lote > 1) salida << "x" << celda.lote;
+    salida << "\tmediana=" << celda.mediana
+           << "ns\tp95=" << celda.p95 << "ns\tMAD=" << celda.mad << "ns\tIC95=[" << celda.intervalo.inferior
+           << ", " << celda.intervalo.superior << "]";
+    if (celda.contadores.algunoDisponible()) {
+        salida << "\tIPC=" << celda.contadores.ipc();
+        for (int e = EventoFallosL1; e < NumEventosContador; e++) {
+            salida << "\t" << nombreEvento(e) << "/elem=" << celda.contadores.porElemento(e, n);
+        }
+    }
+    for (int m = 0; m < NumMetricasMemoria; m++) {
+        if (celda.memoria.disponible(m)) salida << "\t" << claveMetricaMemoria(m) << "=" << celda.memoria.valores[m];
+    }
+    if (!celda.resultadoCorrecto) salida << "\tRESULTADO INCORRECTO";
+    salida << std::endl;
+}
+
+#endif // ARNESBENCHMARK_H
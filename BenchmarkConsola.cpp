@@ -0,0 +1,272 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm> // Para std::replace
+#include <cmath>     // Para log2
+#include <mutex>
+#include "RegistroAlgoritmos.h"   // Algoritmos y casos que se pueden medir
+#include "SalidaResultados.h"     // Salida CSV / líneas JSON
+#include "PlanificadorCeldas.h"   // Celdas en paralelo en núcleos fijados
+#include "ConfiguracionBarrido.h" // Tamaños, casos, repeticiones, presupuesto y semilla
+#include "AlmacenResultados.h"    // Historial para detectar regresiones
+#include "CacheResultados.h"      // Celdas ya medidas con el mismo código
+#include "GanchosMemoria.h"       // Reservas por celda (operator new/delete)
+
+using namespace std;
+
+// Versión de consola de todas las pruebas, sin Qt, para servidores sin pantalla.
+// Los resultados van a la salida estándar (o al archivo) y el resumen de cada celda a stderr.
+
+struct OpcionesConsola {
+    FormatoSalida formato = FormatoSalida::Csv;
+    string archivoSalida; // Vacío: salida estándar
+    string archivoAlmacen; // Vacío: no se guarda en el historial
+    string archivoTraza; // Vacío: no se exportan las zonas de traza
+    ConfiguracionBarrido barrido;
+    ConfiguracionPlanificador planificador;
+    size_t umbralPesadaBytes = 8 << 20; // Entradas de este tamaño o más se consideran pesadas en memoria
+};
+
+// Escribe la celda (y la agrega al almacén, si hay) y su resumen en stderr (las celdas
+// terminan en cualquier orden)
+void publicarCelda(EscritorResultados& escritor, AlmacenResultados* almacen, const string& algoritmo, const string& caso, int n, const EstadisticasCelda& celda,
+                   bool desdeCache) {
+    static mutex mutexResumen;
+    escritor.escribirCelda(algoritmo, caso, n, celda);
+    if (almacen) almacen->agregar(algoritmo, caso, n, celda);
+    lock_guard<mutex> candado(mutexResumen);
+    imprimirCelda(cerr, (algoritmo + " " + caso + " cpu=" + to_string(celda.nucleo) + (desdeCache ? " (caché)" : "")).c_str(), n, celda);
+}
+
+// Serie (algoritmo, caso) recorrida en tamaños crecientes. Cada celda, al terminar, programa
+// la siguiente, para que la predicción de tiempo use las celdas ya medidas de la serie; las
+// series distintas corren en paralelo. Con caché de resultados, las celdas que ya están se
+// leen en vez de medirse.
+class SerieBarrido {
+public:
+    SerieBarrido(const string& algoritmo, const DefinicionCaso& definicion, int indiceCaso, const vector<int>& tamanos,
+                 const OpcionesConsola& opciones, EscritorResultados& escritor, AlmacenResultados* almacen, CacheResultados* cache,
+                 PlanificadorCeldas& planificador)
+        : algoritmo(algoritmo), definicion(definicion), indiceCaso(indiceCaso), tamanos(tamanos),
+          opciones(opciones), escritor(escritor), almacen(almacen), cache(cache), planificador(planificador) {
+        if (cache) {
+            huellaAlgoritmo = huellaCodigo(definicion.codigo);
+            huellaEntradas = huellaGenerador(definicion.generador);
+        }
+    }
+
+    void programarSiguiente() {
+        if (siguiente >= tamanos.size()) return;
+        int n = tamanos[siguiente];
+
+        double prediccionNs;
+        if (excederiaPresupuesto(tamanosMedidos, medianas, n, opciones.barrido.arnes, prediccionNs)) {
+            static mutex mutexAviso;
+            lock_guard<mutex> candado(mutexAviso);
+            cerr << algoritmo << " " << definicion.caso << ": se omiten " << tamanos.size() - siguiente << " celdas desde n=" << n
+                 << " (se predicen " << prediccionNs << " ns por repetición, excede el presupuesto)" << endl;
+            return;
+        }
+
+        TareaCelda tarea;
+        tarea.ejecutar = [this, n](int nucleo) {
+            unsigned semilla = semillaCelda(opciones.barrido.semilla, n, indiceCaso);
+            EstadisticasCelda celda;
+            string clave = cache ? cache->clave(huellaAlgoritmo, huellaEntradas, algoritmo, definicion.caso, n, semilla, opciones.barrido.arnes) : "";
+            bool desdeCache = cache && !refrescarAlgoritmo(opciones.barrido, algoritmo) && cache->buscar(clave, celda);
+            if (!desdeCache) {
+                celda = definicion.medir(n, semilla, opciones.barrido.arnes);
+                celda.nucleo = nucleo;
+                if (cache && !cache->guardar(clave, celda)) cerr << "No se pudo guardar la celda en " << opciones.barrido.directorioResultados << endl;
+            }
+            publicarCelda(escritor, almacen, algoritmo, definicion.caso, n, celda, desdeCache);
+            tamanosMedidos.push_back(n);
+            medianas.push_back(celda.mediana);
+            programarSiguiente();
+        };
+        tarea.costoEstimado = definicion.costo(n);
+        tarea.pesadaMemoria = n * definicion.bytesPorElemento >= opciones.umbralPesadaBytes;
+        siguiente++;
+        planificador.agregar(move(tarea));
+    }
+
+private:
+    string algoritmo;
+    DefinicionCaso definicion;
+    int indiceCaso;
+    const vector<int>& tamanos;
+    const OpcionesConsola& opciones;
+    EscritorResultados& escritor;
+    AlmacenResultados* almacen;
+    CacheResultados* cache;
+    uint64_t huellaAlgoritmo = 0;
+    uint64_t huellaEntradas = 0;
+    PlanificadorCeldas& planificador;
+    size_t siguiente = 0;
+    vector<double> tamanosMedidos, medianas; // Solo los toca la celda en curso de la serie
+};
+
+void imprimirUso() {
+    cerr << "Uso: BenchmarkConsola [--barrido archivo] [--formato csv|json] [--salida archivo]\n"
+            "                        [--almacen archivo] [--traza archivo] [--hilos N] [--con-smt] [--pesadas N]\n"
+            "                        [--clave valor ...]\n"
+            "  --almacen archivo        agrega las celdas al historial de versiones (ver CompararResultados)\n"
+            "  --barrido archivo        configuración \"clave = valor\" (ver ConfiguracionBarrido.h)\n"
+            "  --tamanos E              geom:inicio:fin:puntos | lin:inicio:fin:paso | a,b,c\n"
+            "  --densificar-caches si   puntos extra alrededor de L1, L2 y L3\n"
+            "  --algoritmos L           " << nombresRegistro() << "\n"
+            "  --casos L                mejor,peor,promedio (bst y lista solo tienen estos tres) y para los\n"
+            "                           ordenamientos casi_ordenada,pocos_unicos,sierra,organo,zipf,iguales\n"
+            "  --calentamiento N, --repeticiones-min N, --repeticiones-max N\n"
+            "  --presupuesto-ms T       presupuesto por celda; se omiten las que se predice que lo exceden\n"
+            "  --lote-minimo-ns T       las operaciones más cortas se miden en lotes de al menos T ns\n"
+            "                           (10000; 0: una operación por muestra)\n"
+            "  --semilla S              semilla base de las entradas aleatorias\n"
+            "  --memoria no             no medir reservas, pico de RSS ni fallos de página (el pico de RSS\n"
+            "                           es del proceso: solo se atribuye bien a la celda con --hilos 1)\n"
+            "  --estado-cache E         actual | caliente (una pasada sin medir antes de cada muestra) |\n"
+            "                           frio (cachés expulsadas y entradas vaciadas con clflush) | frio_tlb\n"
+            "                           (TLB de datos expulsada); en los fríos no hay lotes, usar --hilos 1\n"
+            "  --paginas P              sistema | 4k | 2m: entradas, búferes y nodos en una arena de páginas\n"
+            "                           de 4 KiB o de 2 MiB (hugetlbfs si hay reservadas, si no THP)\n"
+            "  --cache-entradas DIR     guarda las entradas de los ordenamientos en DIR y las mapea en las\n"
+            "                           corridas siguientes\n"
+            "  --cache-resultados DIR   guarda cada celda medida en DIR y la reutiliza mientras no cambien el\n"
+            "                           código del algoritmo, el compilador, las banderas, la CPU ni la\n"
+            "                           configuración de la celda\n"
+            "  --refrescar L            algoritmos que se vuelven a medir aunque estén en la caché (todos)\n"
+            "  --hilos N                celdas en paralelo (0: una por núcleo físico, 1: en serie)\n"
+            "  --con-smt                usar también los hermanos SMT de cada núcleo\n"
+            "  --pesadas N              máximo de celdas pesadas en memoria al mismo tiempo\n"
+            "  --traza archivo          exporta las zonas de traza (generar, copiar, estadoCache, medir,\n"
+            "                           verificar) en\n"
+            "                           JSON de Chrome/Perfetto; requiere compilar con -DTRAZAS=ON" << endl;
+}
+
+// Devuelve false si algún argumento no es válido. Las opciones que no son propias de la
+// consola se aplican a la configuración del barrido en el orden en que aparecen, así que
+// pueden sobrescribir lo leído con --barrido.
+bool leerOpciones(int argc, char* argv[], OpcionesConsola& opciones) {
+    for (int i = 1; i < argc; i++) {
+        string argumento = argv[i];
+        if (argumento == "--con-smt") {
+            opciones.planificador.evitarHermanosSMT = false;
+            continue;
+        }
+        if (argumento.rfind("--", 0) != 0 || i + 1 >= argc) return false;
+        string valor = argv[++i];
+        if (argumento == "--formato") {
+            if (valor == "csv") opciones.formato = FormatoSalida::Csv;
+            else if (valor == "json") opciones.formato = FormatoSalida::JsonLineas;
+            else return false;
+        } else if (argumento == "--salida") {
+            opciones.archivoSalida = valor;
+        } else if (argumento == "--almacen") {
+            opciones.archivoAlmacen = valor;
+        } else if (argumento == "--traza") {
+            opciones.archivoTraza = valor;
+        } else if (argumento == "--barrido") {
+            string error;
+            if (!leerArchivoBarrido(valor, opciones.barrido, error)) {
+                cerr << error << endl;
+                return false;
+            }
+        } else if (argumento == "--hilos" || argumento == "--pesadas") {
+            double cantidad;
+            if (!leerNumero(valor, cantidad) || cantidad < 0) return false;
+            if (argumento == "--hilos") opciones.planificador.hilos = static_cast<int>(cantidad);
+            else opciones.planificador.maximoPesadas = static_cast<int>(cantidad);
+        } else {
+            string clave = argumento.substr(2);
+            replace(clave.begin(), clave.end(), '-', '_');
+            if (!aplicarOpcionBarrido(opciones.barrido, clave, valor)) return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    OpcionesConsola opciones;
+    if (!leerOpciones(argc, argv, opciones)) {
+        imprimirUso();
+        return 1;
+    }
+
+    // Con varias celdas en paralelo cada una genera su entrada en un solo hilo; en serie, la
+    // generación usa todas las CPUs
+    PlanificadorCeldas planificador(opciones.planificador);
+    vector<DefinicionAlgoritmo> algoritmos = definirAlgoritmos(opciones.barrido.directorioCache, planificador.nucleosElegidos().size() > 1 ? 1 : 0,
+                                                               opciones.barrido.arnes.paginas);
+    for (const string& nombre : opciones.barrido.algoritmos) {
+        if (none_of(algoritmos.begin(), algoritmos.end(), [&](const DefinicionAlgoritmo& a) { return a.algoritmo == nombre; })) {
+            cerr << "Algoritmo desconocido: " << nombre << endl;
+            return 1;
+        }
+    }
+    for (const string& caso : opciones.barrido.casos) {
+        Distribucion distribucion;
+        if (!leerDistribucion(caso, distribucion) || distribucion == Distribucion::Aleatoria64) {
+            cerr << "Caso desconocido: " << caso << endl;
+            return 1;
+        }
+    }
+
+    ofstream archivo;
+    if (!opciones.archivoSalida.empty()) {
+        archivo.open(opciones.archivoSalida);
+        if (!archivo) {
+            cerr << "No se pudo abrir " << opciones.archivoSalida << endl;
+            return 1;
+        }
+    }
+    EscritorResultados escritor(opciones.archivoSalida.empty() ? cout : archivo, opciones.formato);
+    escritor.escribirEncabezado();
+
+    EntornoMedicion entorno;
+    if (!opciones.archivoAlmacen.empty() || !opciones.barrido.directorioResultados.empty()) entorno = entornoActual();
+    unique_ptr<AlmacenResultados> almacen;
+    if (!opciones.archivoAlmacen.empty()) {
+        almacen = make_unique<AlmacenResultados>(opciones.archivoAlmacen, entorno);
+        if (!almacen->abierto()) {
+            cerr << "No se pudo abrir " << opciones.archivoAlmacen << endl;
+            return 1;
+        }
+        cerr << "Versión: " << entorno.clave() << endl;
+    }
+    unique_ptr<CacheResultados> cache;
+    if (!opciones.barrido.directorioResultados.empty()) cache = make_unique<CacheResultados>(opciones.barrido.directorioResultados, entorno);
+
+    vector<int> tamanos = tamanosBarrido(opciones.barrido);
+    vector<unique_ptr<SerieBarrido>> series;
+    for (const DefinicionAlgoritmo& algoritmo : algoritmos) {
+        if (!incluidoEnBarrido(opciones.barrido.algoritmos, algoritmo.algoritmo)) continue;
+        for (size_t c = 0; c < algoritmo.casos.size(); c++) {
+            if (!incluidoEnBarrido(opciones.barrido.casos, algoritmo.casos[c].caso)) continue;
+            series.push_back(make_unique<SerieBarrido>(algoritmo.algoritmo, algoritmo.casos[c], static_cast<int>(c), tamanos,
+                                                       opciones, escritor, almacen.get(), cache.get(), planificador));
+        }
+    }
+
+    cerr << series.size() << " series x " << tamanos.size() << " tamaños (" << tamanos.front() << " a " << tamanos.back()
+         << ") en " << planificador.nucleosElegidos().size() << " hilos fijados (CPUs:";
+    for (int cpu : planificador.nucleosElegidos()) cerr << " " << cpu;
+    cerr << ")" << endl;
+    cerr << "Reloj: " << relojCiclos().describir() << endl;
+
+    for (auto& serie : series) serie->programarSiguiente();
+    planificador.ejecutar();
+
+    if (!opciones.archivoTraza.empty()) {
+        if (!trazasCompiladas) cerr << "Compilado sin zonas de traza (-DTRAZAS=ON): la traza queda vacía" << endl;
+        if (!exportarTrazaChrome(opciones.archivoTraza)) {
+            cerr << "No se pudo escribir " << opciones.archivoTraza << endl;
+            return 1;
+        }
+        if (size_t perdidos = eventosTrazaPerdidos()) cerr << "Traza: se pisaron los " << perdidos << " eventos más viejos" << endl;
+    }
+
+    return 0;
+}
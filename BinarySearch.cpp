@@ -4,114 +4,77 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <algorithm> // Para std::shuffle
-#include <random>    // Para generador de números aleatorios
 #include <cmath>     // Para operaciones matemáticas
 #include <queue>     // Para el uso de std::queue
+#include "ArbolBusqueda.h" // Nodo, insertar y generadores de los casos
+#include "GraficasArnes.h" // Arnés de repeticiones y barras de dispersión
+#include "GraficaEnVivo.h" // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "GanchosMemoria.h" // Reservas y bytes de cada repetición
+#include "ConfiguracionBarrido.h" // Tamaños desde --barrido / --tamanos
 
 using namespace std;
 using namespace chrono;
 
-// Función para obtener el tiempo actual en nanosegundos
-long long obtenerTiempoSistemaNano() {
-    return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+// Mide el tiempo de inserción en el BST; cada repetición parte de un árbol recién generado
+EstadisticasCelda medirTiempoInsercion(int n, Nodo* (*generarBST)(int), const ConfiguracionArnes& configuracion) {
+    return medirCelda([&] { return ArbolBST(generarBST(n)); },
+                      [&](ArbolBST& arbol) {
+                          for (int i = 0; i < n; ++i) {
+                              insertar(arbol.raiz, i);
+                          }
+                      },
+                      configuracion);
 }
 
-// Definición de un nodo para el árbol binario de búsqueda (BST)
-struct Nodo {
-    int valor;
-    Nodo* izquierda;
-    Nodo* derecha;
-
-    Nodo(int v) : valor(v), izquierda(nullptr), derecha(nullptr) {}
-};
-
-// Inserta un nuevo valor en el árbol BST
-Nodo* insertar(Nodo* raiz, int valor) {
-    if (!raiz) {
-        return new Nodo(valor);
-    }
-    if (valor < raiz->valor) {
-        raiz->izquierda = insertar(raiz->izquierda, valor);
-    } else {
-        raiz->derecha = insertar(raiz->derecha, valor);
-    }
-    return raiz;
-}
-
-// Genera un árbol BST balanceado
-Nodo* generarBSTBalanceado(int n) {
-    vector<int> valores(n);
-    for (int i = 0; i < n; ++i) {
-        valores[i] = i;
-    }
-    random_device rd;
-    mt19937 generador(rd());
-    shuffle(valores.begin(), valores.end(), generador);
-
-    Nodo* raiz = nullptr;
-    for (int v : valores) {
-        raiz = insertar(raiz, v);
-    }
-    return raiz;
-}
-
-// Genera un BST en el peor caso (desequilibrado)
-Nodo* generarBSTPeorCaso(int n) {
-    Nodo* raiz = nullptr;
-    for (int i = 0; i < n; ++i) {
-        raiz = insertar(raiz, i);
-    }
-    return raiz;
-}
-
-// Genera un BST en el caso promedio
-Nodo* generarBSTCasoPromedio(int n) {
-    vector<int> valores(n);
-    for (int i = 0; i < n; ++i) {
-        valores[i] = i;
-    }
-    random_device rd;
-    mt19937 generador(rd());
-    shuffle(valores.begin(), valores.end(), generador);
-
-    Nodo* raiz = nullptr;
-    for (int v : valores) {
-        raiz = insertar(raiz, v);
-    }
-    return raiz;
+// Cuenta las operaciones de la misma inserción con la instanciación que cuenta (sin cronómetro)
+Operaciones contarInsercion(int n, Nodo* (*generarBST)(int)) {
+    ArbolBST arbol(generarBST(n));
+    return contarOperaciones([&] {
+        for (int i = 0; i < n; ++i) {
+            insertar<ConteoOperaciones>(arbol.raiz, i);
+        }
+    });
 }
 
-// Mide el tiempo de inserción en el BST
-long long medirTiempoInsercion(int n, Nodo* (*generarBST)(int)) {
-    Nodo* raiz = generarBST(n);
-    auto inicio = high_resolution_clock::now();
-    for (int i = 0; i < n; ++i) {
-        insertar(raiz, i);
+// Pasada de conteo para los tres casos
+void contarOperacionesPorCaso(const vector<int>& tamanos, vector<Operaciones>& operacionesMejorCaso, vector<Operaciones>& operacionesPeorCaso, vector<Operaciones>& operacionesPromedio) {
+    for (int n : tamanos) {
+        operacionesMejorCaso.push_back(contarInsercion(n, generarBSTBalanceado));
+        imprimirOperaciones(cout, "Mejor caso", n, operacionesMejorCaso.back());
+        operacionesPeorCaso.push_back(contarInsercion(n, generarBSTPeorCaso));
+        imprimirOperaciones(cout, "Peor caso", n, operacionesPeorCaso.back());
+        operacionesPromedio.push_back(contarInsercion(n, generarBSTCasoPromedio));
+        imprimirOperaciones(cout, "Caso promedio", n, operacionesPromedio.back());
     }
-    auto fin = high_resolution_clock::now();
-    return duration_cast<nanoseconds>(fin - inicio).count();
 }
 
 // Ejecuta los benchmarks y almacena los resultados
-void ejecutarBenchmarks(const vector<int>& tamanos, vector<long long>& tiemposMejorCaso, vector<long long>& tiemposPeorCaso, vector<long long>& tiemposPromedio) {
+// Cada celda se publica para la gráfica en vivo en cuanto se mide; si se cerró la ventana se deja de medir
+void ejecutarBenchmarks(const vector<int>& tamanos, vector<EstadisticasCelda>& tiemposMejorCaso, vector<EstadisticasCelda>& tiemposPeorCaso, vector<EstadisticasCelda>& tiemposPromedio, const PublicarCelda& publicar) {
+    ConfiguracionArnes configuracion;
     for (int n : tamanos) {
-        tiemposMejorCaso.push_back(medirTiempoInsercion(n, generarBSTBalanceado));
-        tiemposPeorCaso.push_back(medirTiempoInsercion(n, generarBSTPeorCaso));
-        tiemposPromedio.push_back(medirTiempoInsercion(n, generarBSTCasoPromedio));
+        tiemposMejorCaso.push_back(medirTiempoInsercion(n, generarBSTBalanceado, configuracion));
+        imprimirCelda(cout, "Mejor caso", n, tiemposMejorCaso.back());
+        if (!publicar(0, n, tiemposMejorCaso.back())) return;
+        tiemposPeorCaso.push_back(medirTiempoInsercion(n, generarBSTPeorCaso, configuracion));
+        imprimirCelda(cout, "Peor caso", n, tiemposPeorCaso.back());
+        if (!publicar(1, n, tiemposPeorCaso.back())) return;
+        tiemposPromedio.push_back(medirTiempoInsercion(n, generarBSTCasoPromedio, configuracion));
+        imprimirCelda(cout, "Caso promedio", n, tiemposPromedio.back());
+        if (!publicar(2, n, tiemposPromedio.back())) return;
     }
 }
 
 // Función para graficar los resultados de los benchmarks
-void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<long long>& tiemposMejorCaso, const vector<long long>& tiemposPeorCaso, const vector<long long>& tiemposPromedio) {
+void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<EstadisticasCelda>& tiemposMejorCaso, const vector<EstadisticasCelda>& tiemposPeorCaso, const vector<EstadisticasCelda>& tiemposPromedio) {
     QVector<double> x(tamanos.size()), yMejor(tamanos.size()), yPeor(tamanos.size()), yPromedio(tamanos.size());
 
     // Rellenar los datos
     for (size_t i = 0; i < tamanos.size(); ++i) {
         x[i] = tamanos[i];
-        yMejor[i] = tiemposMejorCaso[i];
-        yPeor[i] = tiemposPeorCaso[i];
-        yPromedio[i] = tiemposPromedio[i];
+        yMejor[i] = tiemposMejorCaso[i].mediana;
+        yPeor[i] = tiemposPeorCaso[i].mediana;
+        yPromedio[i] = tiemposPromedio[i].mediana;
     }
 
     // Graficar los diferentes casos
@@ -130,71 +93,75 @@ void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, con
     customPlot->graph(2)->setPen(QPen(Qt::green));
     customPlot->graph(2)->setName("Caso Promedio");
 
+    // Dispersión de las repeticiones (percentiles 5 a 95)
+    agregarDispersion(customPlot, customPlot->graph(0), tiemposMejorCaso);
+    agregarDispersion(customPlot, customPlot->graph(1), tiemposPeorCaso);
+    agregarDispersion(customPlot, customPlot->graph(2), tiemposPromedio);
+
+    // Curvas del mejor modelo ajustado por mínimos cuadrados a las medianas
+    agregarAjuste(customPlot, customPlot->graph(0), "Mejor Caso", tamanos, ajustarComplejidad(tamanos, tiemposMejorCaso));
+    agregarAjuste(customPlot, customPlot->graph(1), "Peor Caso", tamanos, ajustarComplejidad(tamanos, tiemposPeorCaso));
+    agregarAjuste(customPlot, customPlot->graph(2), "Caso Promedio", tamanos, ajustarComplejidad(tamanos, tiemposPromedio));
+
     // Etiquetas y ajustes de ejes
     customPlot->xAxis->setLabel("Tamaño de entrada");
     customPlot->yAxis->setLabel("Tiempo en nanosegundos");
     customPlot->xAxis->setRange(0, tamanos.back());
-    customPlot->yAxis->setRange(0, *max_element(yPeor.constBegin(), yPeor.constEnd()) + 100);
+    customPlot->yAxis->setRange(0, maximoConDispersion(tiemposPeorCaso) + 100);
 
     customPlot->legend->setVisible(true);
     customPlot->replot();
 }
 
-// Graficar el comportamiento teórico
-void graficarTeorico(QCustomPlot* customPlot, const vector<int>& tamanos) {
-    QVector<double> x(tamanos.size()), yMejor(tamanos.size()), yPeor(tamanos.size()), yPromedio(tamanos.size());
-
-    for (size_t i = 0; i < tamanos.size(); ++i) {
-        x[i] = tamanos[i];
-        yMejor[i] = log2(tamanos[i] + 100); // O(log n)
-        yPeor[i] = tamanos[i];              // O(n)
-        yPromedio[i] = log2(tamanos[i]);    // O(log n)
-    }
-
-    customPlot->addGraph();
-    customPlot->graph(0)->setData(x, yMejor);
-    customPlot->graph(0)->setPen(QPen(Qt::blue, 2));
-    customPlot->graph(0)->setName("Mejor Caso (Teórico)");
-
-    customPlot->addGraph();
-    customPlot->graph(1)->setData(x, yPeor);
-    customPlot->graph(1)->setPen(QPen(Qt::red, 2));
-    customPlot->graph(1)->setName("Peor Caso (Teórico)");
-
-    customPlot->addGraph();
-    customPlot->graph(2)->setData(x, yPromedio);
-    customPlot->graph(2)->setPen(QPen(Qt::green, 2));
-    customPlot->graph(2)->setName("Caso Promedio (Teórico)");
-
-    customPlot->xAxis->setLabel("Tamaño de entrada");
-    customPlot->yAxis->setLabel("Operaciones");
-
-    customPlot->xAxis->setRange(0, tamanos.back());
-    customPlot->yAxis->setRange(0, tamanos.back());
-
-    customPlot->legend->setVisible(true);
-    customPlot->replot();
+// Graficar las operaciones contadas de cada caso (en lugar de fórmulas escritas a mano)
+void graficarOperacionesContadas(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<Operaciones>& operacionesMejorCaso, const vector<Operaciones>& operacionesPeorCaso, const vector<Operaciones>& operacionesPromedio) {
+    graficarOperaciones(customPlot, tamanos, {
+        {"Mejor Caso", Qt::blue, operacionesMejorCaso},
+        {"Peor Caso", Qt::red, operacionesPeorCaso},
+        {"Caso Promedio", Qt::darkGreen, operacionesPromedio},
+    });
 }
 
 int main(int argc, char *argv[]) {
-    vector<int> tamanos = {100, 1000, 5000, 10000, 50000};
-    vector<long long> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
-
-    ejecutarBenchmarks(tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    vector<int> tamanos = tamanosDeArgumentos(argc, argv, {100, 1000, 5000, 10000, 50000});
+    vector<EstadisticasCelda> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
+    vector<Operaciones> operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio;
 
+    // Las inserciones se miden en un hilo de trabajo mientras la ventana ya muestra los puntos
     QApplication app(argc, argv);
-    QCustomPlot customPlot1;
-    customPlot1.legend->setVisible(true);
-    graficarResultados(&customPlot1, tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    QCustomPlot customPlot1, customPlot2, customPlot3, customPlot4;
+    MedicionEnVivo enVivo(&customPlot1, {{"Mejor Caso", Qt::blue}, {"Peor Caso", Qt::red}, {"Caso Promedio", Qt::green}});
     customPlot1.resize(800, 600);
     customPlot1.show();
 
-    QCustomPlot customPlot2;
-    customPlot2.legend->setVisible(true);
-    graficarTeorico(&customPlot2, tamanos);
-    customPlot2.resize(800, 600);
-    customPlot2.show();
+    enVivo.iniciar([&] {
+        ejecutarBenchmarks(tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio, enVivo.publicador());
+        if (!enVivo.cancelada()) contarOperacionesPorCaso(tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+    }, [&] {
+        // Modelo de complejidad que mejor explica los tiempos medidos
+        imprimirAjuste(cout, "mejor caso", ajustarComplejidad(tamanos, tiemposMejorCaso));
+        imprimirAjuste(cout, "peor caso", ajustarComplejidad(tamanos, tiemposPeorCaso));
+        imprimirAjuste(cout, "caso promedio", ajustarComplejidad(tamanos, tiemposPromedio));
+
+        customPlot1.clearPlottables();
+        graficarResultados(&customPlot1, tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+
+        graficarOperacionesContadas(&customPlot2, tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+        customPlot2.resize(800, 600);
+        customPlot2.show();
+
+        // Gráfica de contadores de hardware del caso promedio (solo si el sistema los permite)
+        if (graficarContadores(&customPlot3, tamanos, tiemposPromedio)) {
+            customPlot3.resize(800, 600);
+            customPlot3.show();
+        }
+
+        // Gráfica de memoria por elemento de los tres casos (reservas, bytes, picos y fallos de página)
+        if (graficarMemoria(&customPlot4, tamanos, {{"Mejor Caso", Qt::blue, tiemposMejorCaso}, {"Peor Caso", Qt::red, tiemposPeorCaso}, {"Caso Promedio", Qt::darkGreen, tiemposPromedio}})) {
+            customPlot4.resize(800, 600);
+            customPlot4.show();
+        }
+    });
 
     return app.exec();
 }
-
@@ -4,99 +4,76 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <algorithm> // Para std::shuffle
-#include <random>    // Para std::random_device y std::mt19937
 #include <cmath>     // Para funciones matemáticas
+#include "Ordenamientos.h" // Algoritmos de ordenamiento genéricos
+#include "GraficasArnes.h"  // Arnés de repeticiones y barras de dispersión
+#include "GraficaEnVivo.h"  // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "ConfiguracionBarrido.h" // Tamaños desde --barrido / --tamanos
+#include "GeneradoresEntrada.h"   // Entradas reproducibles de cada caso
+#include "TuberiaEntradas.h"      // Entradas generadas en otro núcleo durante la medición
 
 using namespace std;
 using namespace std::chrono;
 
-// Función para obtener el tiempo actual en nanosegundos
-long long obtenerTiempoActualNano() {
-    return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
-}
+// Ejecutar las pruebas de rendimiento (benchmarks) para los diferentes casos
+// Cada celda se repite con el arnés; la copia de la entrada se hace fuera de la medición
+// Cada celda se publica para la gráfica en vivo en cuanto se mide; si se cerró la ventana se deja de medir
+void ejecutarPruebas(const vector<int>& tamanos, vector<EstadisticasCelda>& tiemposMejorCaso, vector<EstadisticasCelda>& tiemposPeorCaso, vector<EstadisticasCelda>& tiemposPromedio, const PublicarCelda& publicar) {
+    ConfiguracionArnes configuracion;
+    auto ordenar = [](vector<int>& datos) { ordenarBurbuja(datos); };
 
-// Implementación del algoritmo de ordenamiento Burbuja
-void ordenarBurbuja(vector<int>& datos) {
-    int longitud = datos.size();
-    for (int i = 0; i < longitud - 1; i++) {
-        bool huboIntercambio = false;
-        for (int j = 0; j < longitud - i - 1; j++) {
-            if (datos[j] > datos[j + 1]) {
-                swap(datos[j], datos[j + 1]);
-                huboIntercambio = true;
-            }
-        }
-        if (!huboIntercambio) break; // Si no se hicieron intercambios, los datos ya están ordenados
-    }
-}
+    // Las entradas de la celda siguiente se generan en otro núcleo mientras se mide la actual
+    TuberiaEntradas<vector<int>> entradas(generadoresPorTamano<vector<int>>(tamanos, {generarMejorCaso, generarPeorCaso, [](int n) { return generarCasoPromedio(n); }}));
 
-// Generar datos en el mejor caso (ordenados)
-vector<int> generarMejorCaso(int tamano) {
-    vector<int> datos(tamano);
-    for (int i = 0; i < tamano; i++) {
-        datos[i] = i;
-    }
-    return datos;
-}
+    for (int tamano : tamanos) {
+        // Mejor caso
+        const vector<int>& mejorCaso = entradas.siguiente();
+        tiemposMejorCaso.push_back(medirCelda([&] { return mejorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Mejor caso", tamano, tiemposMejorCaso.back());
+        if (!publicar(0, tamano, tiemposMejorCaso.back())) return;
 
-// Generar datos en el peor caso (orden inverso)
-vector<int> generarPeorCaso(int tamano) {
-    vector<int> datos(tamano);
-    for (int i = 0; i < tamano; i++) {
-        datos[i] = tamano - i;
-    }
-    return datos;
-}
+        // Peor caso
+        const vector<int>& peorCaso = entradas.siguiente();
+        tiemposPeorCaso.push_back(medirCelda([&] { return peorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Peor caso", tamano, tiemposPeorCaso.back());
+        if (!publicar(1, tamano, tiemposPeorCaso.back())) return;
 
-// Generar datos en un caso promedio (aleatorio)
-vector<int> generarCasoPromedio(int tamano) {
-    vector<int> datos(tamano);
-    for (int i = 0; i < tamano; i++) {
-        datos[i] = i;
+        // Caso promedio
+        const vector<int>& casoPromedio = entradas.siguiente();
+        tiemposPromedio.push_back(medirCelda([&] { return casoPromedio; }, ordenar, configuracion));
+        imprimirCelda(cout, "Caso promedio", tamano, tiemposPromedio.back());
+        if (!publicar(2, tamano, tiemposPromedio.back())) return;
     }
-    random_device rd;
-    mt19937 generador(rd());
-    shuffle(datos.begin(), datos.end(), generador);
-    return datos;
 }
 
-// Ejecutar las pruebas de rendimiento (benchmarks) para los diferentes casos
-void ejecutarPruebas(const vector<int>& tamanos, vector<long long>& tiemposMejorCaso, vector<long long>& tiemposPeorCaso, vector<long long>& tiemposPromedio) {
+// Pasada sin cronómetro con la instanciación que cuenta operaciones; la medición de tiempo
+// usa la instanciación por defecto (ConteoNulo), que no contiene contadores
+void contarOperacionesPorCaso(const vector<int>& tamanos, vector<Operaciones>& operacionesMejorCaso, vector<Operaciones>& operacionesPeorCaso, vector<Operaciones>& operacionesPromedio) {
     for (int tamano : tamanos) {
-        // Mejor caso
         vector<int> mejorCaso = generarMejorCaso(tamano);
-        long long inicio = obtenerTiempoActualNano();
-        ordenarBurbuja(mejorCaso);
-        long long fin = obtenerTiempoActualNano();
-        tiemposMejorCaso.push_back(fin - inicio);
+        operacionesMejorCaso.push_back(contarOperaciones([&] { ordenarBurbuja<ConteoOperaciones>(mejorCaso); }));
+        imprimirOperaciones(cout, "Mejor caso", tamano, operacionesMejorCaso.back());
 
-        // Peor caso
         vector<int> peorCaso = generarPeorCaso(tamano);
-        inicio = obtenerTiempoActualNano();
-        ordenarBurbuja(peorCaso);
-        fin = obtenerTiempoActualNano();
-        tiemposPeorCaso.push_back(fin - inicio);
+        operacionesPeorCaso.push_back(contarOperaciones([&] { ordenarBurbuja<ConteoOperaciones>(peorCaso); }));
+        imprimirOperaciones(cout, "Peor caso", tamano, operacionesPeorCaso.back());
 
-        // Caso promedio
         vector<int> casoPromedio = generarCasoPromedio(tamano);
-        inicio = obtenerTiempoActualNano();
-        ordenarBurbuja(casoPromedio);
-        fin = obtenerTiempoActualNano();
-        tiemposPromedio.push_back(fin - inicio);
+        operacionesPromedio.push_back(contarOperaciones([&] { ordenarBurbuja<ConteoOperaciones>(casoPromedio); }));
+        imprimirOperaciones(cout, "Caso promedio", tamano, operacionesPromedio.back());
     }
 }
 
 // Función para graficar los resultados de las pruebas
-void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<long long>& tiemposMejorCaso, const vector<long long>& tiemposPeorCaso, const vector<long long>& tiemposPromedio) {
+void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<EstadisticasCelda>& tiemposMejorCaso, const vector<EstadisticasCelda>& tiemposPeorCaso, const vector<EstadisticasCelda>& tiemposPromedio) {
     QVector<double> ejeX(tamanos.size()), tiemposMejor(tamanos.size()), tiemposPeor(tamanos.size()), tiemposProm(tamanos.size());
 
     // Cargar los datos
     for (size_t i = 0; i < tamanos.size(); ++i) {
         ejeX[i] = tamanos[i];
-        tiemposMejor[i] = tiemposMejorCaso[i] + 10000000; // Ajuste para elevar la línea
-        tiemposPeor[i] = tiemposPeorCaso[i];
-        tiemposProm[i] = tiemposPromedio[i];
+        tiemposMejor[i] = tiemposMejorCaso[i].mediana;
+        tiemposPeor[i] = tiemposPeorCaso[i].mediana;
+        tiemposProm[i] = tiemposPromedio[i].mediana;
     }
 
     // Graficar mejor caso
@@ -117,13 +94,23 @@ void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, con
     customPlot->graph(2)->setPen(QPen(Qt::green));
     customPlot->graph(2)->setName("Caso Promedio O(n^2)");
 
+    // Dispersión de las repeticiones (percentiles 5 a 95)
+    agregarDispersion(customPlot, customPlot->graph(0), tiemposMejorCaso);
+    agregarDispersion(customPlot, customPlot->graph(1), tiemposPeorCaso);
+    agregarDispersion(customPlot, customPlot->graph(2), tiemposPromedio);
+
+    // Curvas del mejor modelo ajustado por mínimos cuadrados a las medianas
+    agregarAjuste(customPlot, customPlot->graph(0), "Mejor Caso", tamanos, ajustarComplejidad(tamanos, tiemposMejorCaso));
+    agregarAjuste(customPlot, customPlot->graph(1), "Peor Caso", tamanos, ajustarComplejidad(tamanos, tiemposPeorCaso));
+    agregarAjuste(customPlot, customPlot->graph(2), "Caso Promedio", tamanos, ajustarComplejidad(tamanos, tiemposPromedio));
+
     // Etiquetas de los ejes
     customPlot->xAxis->setLabel("Tamaño de entrada (n)");
     customPlot->yAxis->setLabel("Tiempo (nanosegundos)");
 
     // Ajustar rangos de los ejes
     customPlot->xAxis->setRange(0, tamanos.back());
-    customPlot->yAxis->setRange(0, *max_element(tiemposPeor.begin(), tiemposPeor.end()) + 100);  // Ajuste del eje Y
+    customPlot->yAxis->setRange(0, maximoConDispersion(tiemposPeorCaso) + 100);  // Ajuste del eje Y
 
     // Mostrar leyenda
     customPlot->legend->setVisible(true);
@@ -132,76 +119,54 @@ void graficarResultados(QCustomPlot* customPlot, const vector<int>& tamanos, con
     customPlot->replot();
 }
 
-// Graficar el comportamiento teórico de la complejidad temporal
-void graficarComportamientoTeorico(QCustomPlot* customPlot, const vector<int>& tamanos) {
-    QVector<double> ejeX(tamanos.size()), teoricoMejor(tamanos.size()), teoricoPeor(tamanos.size()), teoricoProm(tamanos.size());
-
-    // Cargar los datos con la complejidad teórica
-    for (size_t i = 0; i < tamanos.size(); ++i) {
-        ejeX[i] = tamanos[i];
-        teoricoMejor[i] = tamanos[i];         // O(n)
-        teoricoPeor[i] = pow(tamanos[i], 2);  // O(n^2)
-        teoricoProm[i] = pow(tamanos[i], 2);  // O(n^2) en promedio
-    }
-
-    // Graficar mejor caso
-    customPlot->addGraph();
-    customPlot->graph(0)->setData(ejeX, teoricoMejor);
-    customPlot->graph(0)->setPen(QPen(Qt::blue, 2));
-    customPlot->graph(0)->setName("Mejor Caso (Teórico) O(n)");
-
-    // Graficar peor caso
-    customPlot->addGraph();
-    customPlot->graph(1)->setData(ejeX, teoricoPeor);
-    customPlot->graph(1)->setPen(QPen(Qt::red, 2));
-    customPlot->graph(1)->setName("Peor Caso (Teórico) O(n^2)");
-
-    // Graficar caso promedio
-    customPlot->addGraph();
-    customPlot->graph(2)->setData(ejeX, teoricoProm);
-    customPlot->graph(2)->setPen(QPen(Qt::green, 2));
-    customPlot->graph(2)->setName("Caso Promedio (Teórico) O(n^2)");
-
-    // Etiquetas de los ejes
-    customPlot->xAxis->setLabel("Tamaño de entrada (n)");
-    customPlot->yAxis->setLabel("Operaciones");
-
-    // Ajustar rangos de los ejes
-    customPlot->xAxis->setRange(0, tamanos.back());
-    customPlot->yAxis->setRange(0, pow(tamanos.back(), 2));  // Ajuste del eje Y
-
-    // Mostrar leyenda
-    customPlot->legend->setVisible(true);
-
-    // Redibujar la gráfica
-    customPlot->replot();
+// Graficar las operaciones contadas de cada caso (en lugar de fórmulas escritas a mano)
+void graficarOperacionesContadas(QCustomPlot* customPlot, const vector<int>& tamanos, const vector<Operaciones>& operacionesMejorCaso, const vector<Operaciones>& operacionesPeorCaso, const vector<Operaciones>& operacionesPromedio) {
+    graficarOperaciones(customPlot, tamanos, {
+        {"Mejor Caso O(n)", Qt::blue, operacionesMejorCaso},
+        {"Peor Caso O(n^2)", Qt::red, operacionesPeorCaso},
+        {"Caso Promedio O(n^2)", Qt::darkGreen, operacionesPromedio},
+    });
 }
 
 int main(int argc, char *argv[]) {
     // Configurar los tamaños de las pruebas
-    vector<int> tamanos = {100, 1000, 5000, 10000, 50000};
-    vector<long long> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
-
-    // Ejecutar las pruebas de rendimiento
-    ejecutarPruebas(tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    vector<int> tamanos = tamanosDeArgumentos(argc, argv, {100, 1000, 5000, 10000, 50000});
+    vector<EstadisticasCelda> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
+    vector<Operaciones> operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio;
 
-    // Iniciar la aplicación gráfica
+    // Iniciar la aplicación gráfica antes de medir, para ver los resultados parciales
     QApplication app(argc, argv);
 
-    // Gráfica de resultados de las pruebas
-    QCustomPlot graficoResultados;
-    graficoResultados.legend->setVisible(true);
-    graficarResultados(&graficoResultados, tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    QCustomPlot graficoResultados, graficoOperaciones, graficoContadores;
+    MedicionEnVivo enVivo(&graficoResultados, {{"Mejor Caso O(n)", Qt::blue}, {"Peor Caso O(n^2)", Qt::red}, {"Caso Promedio O(n^2)", Qt::green}});
     graficoResultados.resize(800, 600);
     graficoResultados.show();
 
-    // Gráfica del comportamiento teórico
-    QCustomPlot graficoTeorico;
-    graficoTeorico.legend->setVisible(true);
-    graficarComportamientoTeorico(&graficoTeorico, tamanos);
-    graficoTeorico.resize(800, 600);
-    graficoTeorico.show();
+    // Ejecutar las pruebas de rendimiento y el conteo de operaciones en el hilo de trabajo
+    enVivo.iniciar([&] {
+        ejecutarPruebas(tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio, enVivo.publicador());
+        if (!enVivo.cancelada()) contarOperacionesPorCaso(tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+    }, [&] {
+        // Modelo de complejidad que mejor explica los tiempos medidos
+        imprimirAjuste(cout, "mejor caso", ajustarComplejidad(tamanos, tiemposMejorCaso));
+        imprimirAjuste(cout, "peor caso", ajustarComplejidad(tamanos, tiemposPeorCaso));
+        imprimirAjuste(cout, "caso promedio", ajustarComplejidad(tamanos, tiemposPromedio));
+
+        // Gráfica de resultados de las pruebas, ahora con dispersión y ajustes
+        graficoResultados.clearPlottables();
+        graficarResultados(&graficoResultados, tamanos, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+
+        // Gráfica de operaciones contadas (comparaciones, intercambios, ...)
+        graficarOperacionesContadas(&graficoOperaciones, tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+        graficoOperaciones.resize(800, 600);
+        graficoOperaciones.show();
+
+        // Gráfica de contadores de hardware del caso promedio (solo si el sistema los permite)
+        if (graficarContadores(&graficoContadores, tamanos, tiemposPromedio)) {
+            graficoContadores.resize(800, 600);
+            graficoContadores.show();
+        }
+    });
 
     return app.exec();
 }
-
@@ -0,0 +1,215 @@
+#ifndef CACHEENTRADAS_H
+#define CACHEENTRADAS_H
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "GeneradoresEntrada.h"
+#include "HuellaCodigo.h"
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Caché de entradas en disco: cada entrada (distribución, tipo, n, semilla, parámetros) se
+// genera una sola vez y se guarda en un archivo binario; las corridas siguientes lo mapean de
+// solo lectura con mmap + MAP_POPULATE (las páginas quedan cargadas antes de medir) y cada
+// repetición copia los datos a su búfer de trabajo. Todos los algoritmos leen los mismos bytes.
+//
+// Archivo: encabezado de 64 bytes (para validar que corresponde a lo pedido) y los n elementos.
+// El encabezado y el nombre llevan la huella del generador (versionGeneradores y el código
+// máquina de generarEntrada<T>): si el generador cambia, el archivo viejo no coincide y la
+// entrada se vuelve a generar.
+
+struct EncabezadoEntrada {
+    char magia[8] = {'E', 'N', 'T', 'R', 'A', 'D', 'A', '2'};
+    uint32_t bytesElemento = 0;
+    uint32_t distribucion = 0;
+    uint64_t n = 0;
+    uint64_t semilla = 0;
+    uint64_t huellaParametros = 0;
+    uint64_t huellaGenerador = 0;
+    char relleno[16] = {};
+};
+
+static_assert(sizeof(EncabezadoEntrada) == 64, "el encabezado ocupa 64 bytes");
+
+inline uint64_t huellaParametros(const ParametrosDistribucion& parametros) {
+    uint64_t huella = mezclar64(static_cast<uint64_t>(parametros.intercambios));
+    huella = mezclar64(huella ^ static_cast<uint64_t>(parametros.unicos));
+    huella = mezclar64(huella ^ static_cast<uint64_t>(parametros.dientes));
+    uint64_t exponente;
+    std::memcpy(&exponente, &parametros.exponenteZipf, sizeof(exponente));
+    huella = mezclar64(huella ^ exponente);
+    return mezclar64(huella ^ static_cast<uint64_t>(parametros.rangosZipf));
+}
+
+// Identidad de un generador de entradas en este ejecutable: la huella de su código y versionGeneradores
+inline uint64_t huellaGenerador(const void* generador) {
+    return mezclar64(huellaCodigo(generador) ^ versionGeneradores);
+}
+
+template <class T>
+uint64_t huellaGenerador() {
+    static const uint64_t huella = huellaGenerador(direccionCodigo(&generarEntrada<T>));
+    return huella;
+}
+
+// Datos de solo lectura de una entrada: mapeados del archivo de la caché o, si no se pudo usar
+// la caché, en memoria
+template <class T>
+class EntradaMapeada {
+public:
+    EntradaMapeada() = default;
+    explicit EntradaMapeada(std::vector<T> datos) : respaldo(std::move(datos)), inicio(respaldo.data()), n(respaldo.size()) {}
+    EntradaMapeada(const EntradaMapeada&) = delete;
+    EntradaMapeada& operator=(const EntradaMapeada&) = delete;
+    EntradaMapeada(EntradaMapeada&& otra) noexcept { *this = std::move(otra); }
+    EntradaMapeada& operator=(EntradaMapeada&& otra) noexcept {
+        if (this != &otra) {
+            liberar();
+            mapa = std::exchange(otra.mapa, nullptr);
+            bytesMapa = std::exchange(otra.bytesMapa, 0);
+            respaldo = std::move(otra.respaldo);
+            inicio = mapa ? otra.inicio : respaldo.data();
+            n = std::exchange(otra.n, 0);
+            otra.inicio = nullptr;
+        }
+        return *this;
+    }
+    ~EntradaMapeada() { liberar(); }
+
+    // Mapea el archivo completo; devuelve false si no existe o no es válido
+    bool abrir(const std::string& ruta, const EncabezadoEntrada& esperado) {
+#if defined(__unix__)
+        int descriptor = ::open(ruta.c_str(), O_RDONLY);
+        if (descriptor < 0) return false;
+        struct stat estado;
+        bool valido = fstat(descriptor, &estado) == 0 &&
+                      static_cast<uint64_t>(estado.st_size) == sizeof(EncabezadoEntrada) + esperado.n * sizeof(T);
+        void* direccion = MAP_FAILED;
+        if (valido) {
+            int banderas = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+            banderas |= MAP_POPULATE;
+#endif
+            direccion = mmap(nullptr, estado.st_size, PROT_READ, banderas, descriptor, 0);
+        }
+        ::close(descriptor);
+        if (direccion == MAP_FAILED) return false;
+        if (std::memcmp(direccion, &esperado, sizeof(EncabezadoEntrada)) != 0) {
+            munmap(direccion, estado.st_size);
+            return false;
+        }
+        liberar();
+        mapa = direccion;
+        bytesMapa = estado.st_size;
+        inicio = reinterpret_cast<const T*>(static_cast<const char*>(direccion) + sizeof(EncabezadoEntrada));
+        n = esperado.n;
+        return true;
+#else
+        // Sin mmap: se lee el archivo completo
+        std::ifstream archivo(ruta, std::ios::binary);
+        EncabezadoEntrada encabezado;
+        if (!archivo.read(reinterpret_cast<char*>(&encabezado), sizeof(encabezado)) ||
+            std::memcmp(&encabezado, &esperado, sizeof(encabezado)) != 0) return false;
+        std::vector<T> datos(esperado.n);
+        if (!archivo.read(reinterpret_cast<char*>(datos.data()), datos.size() * sizeof(T))) return false;
+        *this = EntradaMapeada(std::move(datos));
+        return true;
+#endif
+    }
+
+    bool mapeada() const { return mapa != nullptr; }
+    const T* datos() const { return inicio; }
+    const T* begin() const { return inicio; }
+    const T* end() const { return inicio + n; }
+    size_t size() const { return n; }
+
+    // Copia de trabajo para una repetición
+    std::vector<T> copia() const { return std::vector<T>(begin(), end()); }
+
+private:
+    void liberar() {
+#if defined(__unix__)
+        if (mapa) munmap(mapa, bytesMapa);
+#endif
+        mapa = nullptr;
+    }
+
+    void* mapa = nullptr;
+    size_t bytesMapa = 0;
+    std::vector<T> respaldo;
+    const T* inicio = nullptr;
+    size_t n = 0;
+};
+
+// Ruta del archivo de una entrada dentro del directorio de la caché
+template <class T>
+std::string rutaEntrada(const std::string& directorio, Distribucion distribucion, size_t n, uint64_t semilla, const ParametrosDistribucion& parametros) {
+    std::ostringstream nombre;
+    nombre << directorio << "/" << nombreDistribucion(distribucion) << "_" << sizeof(T) << "B_n" << n << "_s" << semilla
+           << "_p" << std::hex << (huellaParametros(parametros) & 0xffffffff) << "_g" << (huellaGenerador<T>() & 0xffffffff) << ".bin";
+    return nombre.str();
+}
+
+// Escribe el archivo con un nombre temporal y lo renombra al final, para que otro hilo o
+// proceso nunca mapee un archivo a medio escribir
+template <class T>
+bool escribirEntrada(const std::string& ruta, const EncabezadoEntrada& encabezado, const std::vector<T>& datos) {
+    std::ostringstream temporal;
+    temporal << ruta << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id());
+#if defined(__unix__)
+    temporal << "." << getpid();
+#endif
+    {
+        std::ofstream archivo(temporal.str(), std::ios::binary | std::ios::trunc);
+        archivo.write(reinterpret_cast<const char*>(&encabezado), sizeof(encabezado));
+        archivo.write(reinterpret_cast<const char*>(datos.data()), datos.size() * sizeof(T));
+        if (!archivo) {
+            std::error_code error;
+            std::filesystem::remove(temporal.str(), error);
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporal.str(), ruta, error);
+    return !error;
+}
+
+// Entrada de la caché: la mapea si ya existe; si no, la genera, la guarda y la mapea. Con
+// directorio vacío, o si no se puede escribir, devuelve la entrada generada en memoria.
+template <class T = int>
+EntradaMapeada<T> obtenerEntrada(const std::string& directorio, Distribucion distribucion, size_t n, uint64_t semilla = semillaEntradas,
+                                 const ParametrosDistribucion& parametros = {}, int hilos = 0) {
+    if (directorio.empty()) return EntradaMapeada<T>(generarEntrada<T>(distribucion, n, semilla, parametros, hilos));
+
+    EncabezadoEntrada encabezado;
+    encabezado.bytesElemento = sizeof(T);
+    encabezado.distribucion = static_cast<uint32_t>(distribucion);
+    encabezado.n = n;
+    encabezado.semilla = semilla;
+    encabezado.huellaParametros = huellaParametros(parametros);
+    encabezado.huellaGenerador = huellaGenerador<T>();
+
+    EntradaMapeada<T> entrada;
+    std::string ruta = rutaEntrada<T>(directorio, distribucion, n, semilla, parametros);
+    if (entrada.abrir(ruta, encabezado)) return entrada;
+
+    std::vector<T> datos = generarEntrada<T>(distribucion, n, semilla, parametros, hilos);
+    std::error_code error;
+    std::filesystem::create_directories(directorio, error);
+    if (escribirEntrada(ruta, encabezado, datos) && entrada.abrir(ruta, encabezado)) return entrada;
+    return EntradaMapeada<T>(std::move(datos));
+}
+
+#endif // CACHEENTRADAS_H
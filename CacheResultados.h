@@ -0,0 +1,150 @@
+#ifndef CACHERESULTADOS_H
+#define CACHERESULTADOS_H
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "AlmacenResultados.h" // EntornoMedicion
+#include "ArnesBenchmark.h"
+#include "HuellaCodigo.h"
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+// Caché de resultados en disco: cada celda medida se guarda en un archivo cuyo nombre es la
+// huella de su clave, y una corrida posterior con la misma clave la lee en vez de medirla.
+// La clave junta la huella del código máquina del algoritmo y la del generador de su entrada
+// (HuellaCodigo.h, con versionGeneradores), el compilador y sus banderas, el modelo de CPU, el
+// algoritmo, el caso (distribución), n, la semilla y la configuración del arnés; no incluye el
+// commit, así que cambiar un algoritmo o un generador solo vuelve a medir las celdas que los
+// usan. Los cambios en el arnés mismo no entran en la huella: después de tocarlo hay que
+// refrescar la caché.
+//
+// Archivo (texto): la clave completa, para descartar colisiones de la huella, y los datos
+// crudos de la celda (muestras y lecturas por repetición); el resumen se recalcula al leer.
+
+// Cambiar si cambia el formato del archivo o lo que significa una muestra
+inline constexpr int versionCacheResultados = 1;
+
+inline std::string claveResultado(const EntornoMedicion& entorno, uint64_t huellaAlgoritmo, uint64_t huellaEntradas, const std::string& algoritmo,
+                                  const std::string& caso, int n, unsigned semilla, const ConfiguracionArnes& arnes) {
+    std::ostringstream clave;
+    clave << "v" << versionCacheResultados << "|codigo=" << std::hex << huellaAlgoritmo << "|generador=" << huellaEntradas << std::dec << "|" << entorno.compilador << "|"
+          << entorno.banderas << "|" << entorno.cpu << "|" << algoritmo << "|" << caso << "|n=" << n << "|semilla=" << semilla
+          << "|arnes=" << arnes.calentamiento << "," << arnes.repeticionesMinimas << "," << arnes.repeticionesMaximas << ","
+          << arnes.anchoRelativoMaximo << "," << arnes.presupuestoNs << "," << arnes.contadoresHardware << "," << arnes.memoria << ","
+          << arnes.loteMinimoNs << "," << arnes.loteMaximo << "," << nombreEstadoCache(arnes.estadoCache) << ","
+          << nombreTipoPaginas(arnes.paginas);
+    return limpiarCampo(clave.str());
+}
+
+class CacheResultados {
+public:
+    CacheResultados(std::string directorio, EntornoMedicion entorno) : directorio(std::move(directorio)), entorno(std::move(entorno)) {
+        std::error_code error;
+        std::filesystem::create_directories(this->directorio, error);
+    }
+
+    std::string clave(uint64_t huellaAlgoritmo, uint64_t huellaEntradas, const std::string& algoritmo, const std::string& caso, int n,
+                      unsigned semilla, const ConfiguracionArnes& arnes) const {
+        return claveResultado(entorno, huellaAlgoritmo, huellaEntradas, algoritmo, caso, n, semilla, arnes);
+    }
+
+    // Devuelve false si la celda no está (o el archivo no corresponde a la clave)
+    bool buscar(const std::string& clave, EstadisticasCelda& celda) const {
+        std::ifstream archivo(ruta(clave));
+        std::string linea;
+        if (!std::getline(archivo, linea) || linea != clave) return false;
+
+        std::vector<double> muestras;
+        std::vector<LecturaContadores> lecturas;
+        std::vector<LecturaMemoria> lecturasMemoria;
+        long long lote = 1;
+        int nucleo = -1;
+        bool correcto = true;
+        while (std::getline(archivo, linea)) {
+            std::istringstream campos(linea);
+            std::string tipo;
+            campos >> tipo;
+            if (tipo == "celda") {
+                campos >> lote >> nucleo >> correcto;
+            } else if (tipo == "muestra") {
+                double ns;
+                LecturaContadores contadores;
+                LecturaMemoria memoria;
+                campos >> ns;
+                for (long long& valor : contadores.valores) campos >> valor;
+                for (long long& valor : memoria.valores) campos >> valor;
+                muestras.push_back(ns);
+                lecturas.push_back(contadores);
+                lecturasMemoria.push_back(memoria);
+            }
+            if (!campos) return false;
+        }
+        if (muestras.empty()) return false;
+
+        // Sin contadores ni memoria el arnés deja los vectores de lecturas vacíos
+        celda = resumirMuestras(std::move(muestras));
+        celda.contadores = medianaContadores(lecturas);
+        if (celda.contadores.algunoDisponible()) celda.lecturas = std::move(lecturas);
+        celda.memoria = medianaMemoria(lecturasMemoria);
+        if (celda.memoria.algunaDisponible()) celda.lecturasMemoria = std::move(lecturasMemoria);
+        celda.lote = lote;
+        celda.nucleo = nucleo;
+        celda.resultadoCorrecto = correcto;
+        return true;
+    }
+
+    // Escribe con un nombre temporal y renombra, como CacheEntradas.h; false si no se pudo
+    bool guardar(const std::string& clave, const EstadisticasCelda& celda) const {
+        std::string destino = ruta(clave);
+        std::ostringstream temporal;
+        temporal << destino << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id());
+#if defined(__unix__)
+        temporal << "." << getpid();
+#endif
+        {
+            std::ofstream archivo(temporal.str(), std::ios::trunc);
+            archivo << std::setprecision(std::numeric_limits<double>::max_digits10);
+            archivo << clave << "\n";
+            archivo << "celda " << celda.lote << " " << celda.nucleo << " " << celda.resultadoCorrecto << "\n";
+            for (size_t r = 0; r < celda.muestras.size(); r++) {
+                LecturaContadores contadores = r < celda.lecturas.size() ? celda.lecturas[r] : LecturaContadores();
+                LecturaMemoria memoria = r < celda.lecturasMemoria.size() ? celda.lecturasMemoria[r] : LecturaMemoria();
+                archivo << "muestra " << celda.muestras[r];
+                for (long long valor : contadores.valores) archivo << " " << valor;
+                for (long long valor : memoria.valores) archivo << " " << valor;
+                archivo << "\n";
+            }
+            if (!archivo) {
+                std::error_code error;
+                std::filesystem::remove(temporal.str(), error);
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temporal.str(), destino, error);
+        return !error;
+    }
+
+private:
+    std::string ruta(const std::string& clave) const {
+        std::ostringstream nombre;
+        nombre << directorio << "/" << std::hex << std::setw(16) << std::setfill('0') << huellaBytes(clave.data(), clave.size()) << ".celda";
+        return nombre.str();
+    }
+
+    std::string directorio;
+    EntornoMedicion entorno;
+};
+
+#endif // CACHERESULTADOS_H
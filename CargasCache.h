@@ -0,0 +1,72 @@
+#ifndef CARGASCACHE_H
+#define CARGASCACHE_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+#include "Ordenamientos.h"   // Merge Sort
+#include "ArbolBusqueda.h"   // Inserción en BST
+#include "ListaOrdenada.h"   // Búsqueda en lista ordenada
+#include "ArnesBenchmark.h"  // Arnés y arena de páginas
+#include "GeneradoresEntrada.h"
+
+// Cargas sensibles a la jerarquía de memoria, compartidas por JerarquiaCache.cpp (tiempo
+// contra conjunto de trabajo) y CompararPaginas.cpp (páginas de 4 KiB contra 2 MiB): Merge
+// Sort, la inserción en un BST aleatorio y el recorrido de una lista con los nodos dispersos.
+
+struct CargaCache {
+    std::string nombre;
+    size_t bytesPorElemento; // Conjunto de trabajo por elemento, con lo que agrega el asignador a cada nodo
+    std::string operacion;   // Unidad del tiempo por operación
+    double (*operaciones)(int n);
+    std::function<EstadisticasCelda(int n, const ConfiguracionArnes&)> medir;
+};
+
+// Lista ordenada cuyos nodos quedan en orden aleatorio en memoria: se insertan en orden
+// aleatorio y list::sort los reenlaza sin moverlos, así que recorrerla no se beneficia de la
+// precarga secuencial
+inline std::list<int> generarListaDispersa(int n) {
+    std::vector<int> valores = generarCasoPromedio(n);
+    std::list<int> lista(valores.begin(), valores.end());
+    lista.sort();
+    return lista;
+}
+
+// paginas: la arena de las celdas, que decide cuánto ocupa cada nodo
+inline std::vector<CargaCache> definirCargas(TipoPaginas paginas = TipoPaginas::Sistema) {
+    return {
+        {"mezcla", 2 * sizeof(int), "comparación", [](int n) { return n * std::log2(std::max(n, 2)); },
+         [](int n, const ConfiguracionArnes& arnes) {
+             std::vector<int> entrada = generarCasoPromedio(n);
+             return medirCelda([&] { return entrada; }, [](std::vector<int>& datos) { ordenarPorMezcla(datos); }, arnes);
+         }},
+        // Árbol aleatorio de n nodos más los n que se insertan
+        {"bst", 2 * bytesOcupadosReserva(sizeof(Nodo), paginas), "nivel visitado", [](int n) { return n * std::log2(std::max(2 * n, 2)); },
+         [](int n, const ConfiguracionArnes& arnes) {
+             std::vector<int> valores = generarEntrada(Distribucion::Aleatoria, n, semillaEntradas ^ 1);
+             return medirCelda([&] { return ArbolBST(generarBSTCasoPromedio(n)); },
+                               [&](ArbolBST& arbol) {
+                                   for (int valor : valores) insertar(arbol.raiz, valor);
+                               },
+                               arnes);
+         }},
+        // Búsqueda de un valor mayor que todos: recorre los n nodos. La lista se arma fuera de
+        // preparar(), con sus nodos en una arena propia
+        {"lista", bytesOcupadosReserva(3 * sizeof(void*), paginas), "nodo", [](int n) { return static_cast<double>(n); },
+         [](int n, const ConfiguracionArnes& arnes) {
+             ArenaPaginas arena(arnes.paginas);
+             std::list<int> lista;
+             {
+                 UsarArena usar(arena);
+                 lista = generarListaDispersa(n);
+             }
+             return medirCelda([&]() -> const std::list<int>& { return lista; },
+                               [n](const std::list<int>& datos) { evitarOptimizacion(buscarEnListaOrdenada(datos, n)); }, arnes);
+         }},
+    };
+}
+
+#endif // CARGASCACHE_H
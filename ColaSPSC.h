@@ -0,0 +1,55 @@
+#ifndef COLASPSC_H
+#define COLASPSC_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Cola sin candados de un solo productor y un solo consumidor sobre un arreglo circular de
+// capacidad fija (potencia de dos). El productor solo escribe "fin" y el consumidor solo
+// "inicio"; la publicación release/acquire de cada índice garantiza que el otro hilo vea el
+// elemento completo. Los índices van en líneas de caché separadas para no compartirlas.
+
+template <class T>
+class ColaSPSC {
+public:
+    explicit ColaSPSC(size_t capacidadMinima = 256) {
+        size_t capacidad = 2;
+        while (capacidad < capacidadMinima) capacidad <<= 1;
+        elementos.resize(capacidad);
+        mascara = capacidad - 1;
+    }
+
+    ColaSPSC(const ColaSPSC&) = delete;
+    ColaSPSC& operator=(const ColaSPSC&) = delete;
+
+    // Solo desde el hilo productor; false si la cola está llena
+    bool intentarEncolar(T&& valor) {
+        size_t posicion = fin.load(std::memory_order_relaxed);
+        if (posicion - inicio.load(std::memory_order_acquire) > mascara) return false;
+        elementos[posicion & mascara] = std::move(valor);
+        fin.store(posicion + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Solo desde el hilo consumidor; false si la cola está vacía
+    bool intentarDesencolar(T& valor) {
+        size_t posicion = inicio.load(std::memory_order_relaxed);
+        if (posicion == fin.load(std::memory_order_acquire)) return false;
+        valor = std::move(elementos[posicion & mascara]);
+        inicio.store(posicion + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool vacia() const { return inicio.load(std::memory_order_acquire) == fin.load(std::memory_order_acquire); }
+
+private:
+    static constexpr size_t lineaCache = 64;
+    alignas(lineaCache) std::atomic<size_t> inicio{0}; // Próximo a leer (consumidor)
+    alignas(lineaCache) std::atomic<size_t> fin{0};    // Próximo a escribir (productor)
+    alignas(lineaCache) std::vector<T> elementos;
+    size_t mascara = 0;
+};
+
+#endif // COLASPSC_H
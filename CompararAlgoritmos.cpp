@@ -0,0 +1,236 @@
+#include "qcustomplot.h"
+#include <QApplication>
+#include <QVector>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "RegistroAlgoritmos.h"   // Algoritmos y casos que se pueden medir
+#include "GraficasArnes.h"        // Barras de dispersión
+#include "GraficaEnVivo.h"        // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "GanchosMemoria.h"       // Reservas y bytes de cada repetición
+#include "ConfiguracionBarrido.h" // Tamaños, algoritmos, casos y opciones del arnés
+
+using namespace std;
+
+// Comparador de algoritmos: mide cualquier subconjunto del registro (RegistroAlgoritmos.h) en
+// un solo proceso, con las mismas entradas para todos (la semilla depende solo de n y del
+// caso), y los grafica sobre los mismos ejes para leer directamente dónde se cruzan. Los
+// tamaños se recorren en orden creciente intercalando las series, así todas las curvas avanzan
+// juntas en la gráfica en vivo; al final se imprimen los cruces entre cada par de series.
+// Uso: CompararAlgoritmos [--algoritmos burbuja,mezcla,...] [--casos promedio,...] [--tamanos E]
+//                         [--log-log si|no] [--traza archivo.json] [--clave valor]
+// --traza exporta al salir las zonas de traza del arnés y de los replots (compilado con -DTRAZAS=ON)
+// (las demás claves son las del arnés en ConfiguracionBarrido.h: repeticiones_max, presupuesto_ms, ...)
+
+// Un caso de un algoritmo con las celdas medidas hasta ahora
+struct SerieComparada {
+    string algoritmo;
+    string complejidad;
+    DefinicionCaso caso;
+    int indiceCaso;
+    vector<int> tamanos;
+    vector<EstadisticasCelda> celdas;
+    bool omitida = false; // La siguiente celda excedería el presupuesto
+};
+
+string nombreSerie(const SerieComparada& serie, bool variosCasos) {
+    string nombre = serie.algoritmo;
+    if (variosCasos) nombre += " " + serie.caso.caso;
+    if (serie.caso.caso == "promedio") nombre += " " + serie.complejidad;
+    return nombre;
+}
+
+// En el hilo de trabajo: cada tamaño para todas las series antes de pasar al siguiente
+void medirSeries(vector<SerieComparada>& series, const vector<int>& tamanos, const ConfiguracionBarrido& barrido, const PublicarCelda& publicar) {
+    for (int n : tamanos) {
+        for (size_t s = 0; s < series.size(); s++) {
+            SerieComparada& serie = series[s];
+            if (serie.omitida) continue;
+
+            vector<double> tamanosMedidos(serie.tamanos.begin(), serie.tamanos.end()), medianas;
+            for (const EstadisticasCelda& celda : serie.celdas) medianas.push_back(celda.mediana);
+            double prediccionNs;
+            if (excederiaPresupuesto(tamanosMedidos, medianas, n, barrido.arnes, prediccionNs)) {
+                cout << serie.algoritmo << " " << serie.caso.caso << ": se omiten los tamaños desde n=" << n << " (se predicen "
+                     << prediccionNs << " ns por repetición, excede el presupuesto)" << endl;
+                serie.omitida = true;
+                continue;
+            }
+
+            EstadisticasCelda celda = serie.caso.medir(n, semillaCelda(barrido.semilla, n, serie.indiceCaso), barrido.arnes);
+            imprimirCelda(cout, (serie.algoritmo + " " + serie.caso.caso).c_str(), n, celda);
+            serie.tamanos.push_back(n);
+            serie.celdas.push_back(celda);
+            if (!publicar(static_cast<int>(s), n, celda)) return;
+        }
+    }
+}
+
+// Tamaño (interpolado en escala logarítmica) donde dos series cambian de orden, entre cada
+// par de tamaños consecutivos que ambas midieron
+struct Cruce {
+    size_t serieA, serieB;
+    double n;
+    bool aMasRapidaAntes;
+};
+
+vector<Cruce> buscarCruces(const vector<SerieComparada>& series) {
+    vector<Cruce> cruces;
+    for (size_t a = 0; a < series.size(); a++) {
+        for (size_t b = a + 1; b < series.size(); b++) {
+            size_t comunes = min(series[a].celdas.size(), series[b].celdas.size());
+            for (size_t i = 0; i + 1 < comunes; i++) {
+                double antes = log(series[a].celdas[i].mediana / series[b].celdas[i].mediana);
+                double despues = log(series[a].celdas[i + 1].mediana / series[b].celdas[i + 1].mediana);
+                if (!isfinite(antes) || !isfinite(despues) || antes == 0 || (antes < 0) == (despues < 0)) continue;
+                double fraccion = antes / (antes - despues);
+                double logN = log(series[a].tamanos[i]) + fraccion * (log(series[a].tamanos[i + 1]) - log(series[a].tamanos[i]));
+                cruces.push_back({a, b, exp(logN), antes < 0});
+            }
+        }
+    }
+    return cruces;
+}
+
+// Gráfica final: medianas con dispersión de cada serie y una línea vertical en cada cruce
+void graficarComparacion(QCustomPlot* grafico, const vector<SerieComparada>& series, const vector<QColor>& colores,
+                         const vector<Qt::PenStyle>& estilos, bool variosCasos, bool logLog, const vector<Cruce>& cruces) {
+    for (size_t s = 0; s < series.size(); s++) {
+        QVector<double> x, y;
+        for (size_t i = 0; i < series[s].celdas.size(); i++) {
+            x.push_back(series[s].tamanos[i]);
+            y.push_back(series[s].celdas[i].mediana);
+        }
+        QCPGraph* grafica = grafico->addGraph();
+        grafica->setData(x, y);
+        grafica->setPen(QPen(colores[s], 2, estilos[s]));
+        grafica->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 4));
+        grafica->setName(QString::fromStdString(nombreSerie(series[s], variosCasos)));
+        agregarDispersion(grafico, grafica, series[s].celdas);
+    }
+
+    for (const Cruce& cruce : cruces) {
+        QCPItemStraightLine* linea = new QCPItemStraightLine(grafico);
+        linea->point1->setCoords(cruce.n, logLog ? 1 : 0);
+        linea->point2->setCoords(cruce.n, logLog ? 10 : 1);
+        linea->setPen(QPen(Qt::gray, 1, Qt::DashLine));
+
+        QCPItemText* etiqueta = new QCPItemText(grafico);
+        etiqueta->position->setTypeX(QCPItemPosition::ptPlotCoords);
+        etiqueta->position->setTypeY(QCPItemPosition::ptAxisRectRatio);
+        etiqueta->position->setCoords(cruce.n, 0.02);
+        etiqueta->setPositionAlignment(Qt::AlignLeft | Qt::AlignTop);
+        etiqueta->setText(QString::fromStdString(series[cruce.serieA].algoritmo + "/" + series[cruce.serieB].algoritmo) +
+                          " n≈" + QString::number(cruce.n, 'g', 3));
+        etiqueta->setColor(Qt::gray);
+    }
+
+    grafico->rescaleAxes();
+    if (!logLog) {
+        grafico->xAxis->setRangeLower(0);
+        grafico->yAxis->setRangeLower(0);
+    }
+    grafico->legend->setVisible(true);
+    grafico->replot();
+}
+
+int main(int argc, char *argv[]) {
+    // Por defecto el caso promedio en una escalera geométrica que empieza en n pequeños, donde
+    // suelen estar los cruces entre los cuadráticos y Merge Sort
+    ConfiguracionBarrido barrido;
+    barrido.casos = {"promedio"};
+    leerEscalera("geom:16:50000:16", barrido.tamanos);
+    bool logLog = true;
+    string archivoTraza;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string clave = argv[i], valor = argv[i + 1];
+        if (clave.rfind("--", 0) != 0) continue; // Argumentos de Qt
+        clave = clave.substr(2);
+        replace(clave.begin(), clave.end(), '-', '_');
+        bool valido;
+        if (clave == "log_log") valido = leerSiNo(valor, logLog);
+        else if (clave == "traza") valido = !(archivoTraza = valor).empty();
+        else valido = aplicarOpcionBarrido(barrido, clave, valor);
+        if (!valido) {
+            cerr << "Opción no válida: --" << clave << " " << valor << endl;
+            return 1;
+        }
+    }
+    for (const string& nombre : barrido.algoritmos) {
+        if (!buscarEnRegistro(nombre)) {
+            cerr << "Algoritmo desconocido: " << nombre << " (" << nombresRegistro() << ")" << endl;
+            return 1;
+        }
+    }
+
+    // Series en el orden del registro; un color por algoritmo y un estilo de línea por caso
+    const QColor paleta[] = {Qt::blue, Qt::red, Qt::darkGreen, Qt::magenta, Qt::darkCyan, Qt::darkYellow, Qt::black};
+    const Qt::PenStyle estilosCaso[] = {Qt::SolidLine, Qt::DashLine, Qt::DotLine, Qt::DashDotLine, Qt::DashDotDotLine};
+    vector<SerieComparada> series;
+    vector<QColor> colores;
+    vector<Qt::PenStyle> estilos;
+    vector<string> casosElegidos;
+    int indiceAlgoritmo = 0;
+    for (const EntradaRegistro& entrada : registroAlgoritmos) {
+        if (!incluidoEnBarrido(barrido.algoritmos, entrada.nombre)) continue;
+        DefinicionAlgoritmo definicion = entrada.definir(barrido.directorioCache, 0, barrido.arnes.paginas);
+        for (size_t c = 0; c < definicion.casos.size(); c++) {
+            const string& caso = definicion.casos[c].caso;
+            if (!incluidoEnBarrido(barrido.casos, caso)) continue;
+            auto posicion = find(casosElegidos.begin(), casosElegidos.end(), caso);
+            if (posicion == casosElegidos.end()) posicion = casosElegidos.insert(casosElegidos.end(), caso);
+            series.push_back({entrada.nombre, entrada.complejidad, definicion.casos[c], static_cast<int>(c), {}, {}});
+            colores.push_back(paleta[indiceAlgoritmo % 7]);
+            estilos.push_back(estilosCaso[(posicion - casosElegidos.begin()) % 5]);
+        }
+        indiceAlgoritmo++;
+    }
+    if (series.empty()) {
+        cerr << "Ningún algoritmo tiene los casos pedidos con --casos" << endl;
+        return 1;
+    }
+    vector<int> tamanos = tamanosBarrido(barrido);
+    bool variosCasos = casosElegidos.size() > 1;
+    cout << series.size() << " series x " << tamanos.size() << " tamaños (" << tamanos.front() << " a " << tamanos.back() << ")" << endl;
+    cout << "Reloj: " << relojCiclos().describir() << endl;
+
+    QApplication aplicacion(argc, argv);
+
+    QCustomPlot grafico;
+    vector<SerieEnVivo> seriesEnVivo;
+    for (size_t s = 0; s < series.size(); s++) seriesEnVivo.push_back({QString::fromStdString(nombreSerie(series[s], variosCasos)), colores[s]});
+    MedicionEnVivo enVivo(&grafico, seriesEnVivo);
+    if (logLog) {
+        for (QCPAxis* eje : {grafico.xAxis, grafico.yAxis}) {
+            eje->setScaleType(QCPAxis::stLogarithmic);
+            eje->setTicker(QSharedPointer<QCPAxisTickerLog>(new QCPAxisTickerLog));
+        }
+    }
+    grafico.setWindowTitle("Comparación de algoritmos");
+    grafico.resize(1000, 600);
+    grafico.show();
+
+    enVivo.iniciar([&] { medirSeries(series, tamanos, barrido, enVivo.publicador()); }, [&] {
+        vector<Cruce> cruces = buscarCruces(series);
+        cout << endl << (cruces.empty() ? "Sin cruces entre las series medidas" : "Cruces (n interpolado en escala logarítmica):") << endl;
+        for (const Cruce& cruce : cruces) {
+            const SerieComparada& antes = series[cruce.aMasRapidaAntes ? cruce.serieA : cruce.serieB];
+            const SerieComparada& despues = series[cruce.aMasRapidaAntes ? cruce.serieB : cruce.serieA];
+            cout << "  n≈" << static_cast<long long>(llround(cruce.n)) << ": " << nombreSerie(antes, variosCasos) << " es más rápido antes, "
+                 << nombreSerie(despues, variosCasos) << " después" << endl;
+        }
+
+        grafico.clearPlottables();
+        graficarComparacion(&grafico, series, colores, estilos, variosCasos, logLog, cruces);
+    });
+
+    int resultado = aplicacion.exec();
+    enVivo.detener();
+    if (!archivoTraza.empty()) {
+        if (!trazasCompiladas) cerr << "Compilado sin zonas de traza (-DTRAZAS=ON): la traza queda vacía" << endl;
+        if (!exportarTrazaChrome(archivoTraza)) cerr << "No se pudo escribir " << archivoTraza << endl;
+    }
+    return resultado;
+}
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "CargasCache.h"          // Merge Sort, inserción en BST y lista dispersa
+#include "ConfiguracionBarrido.h" // Escaleras de tamaños y opciones del arnés
+#include "GanchosMemoria.h"       // Las reservas de las cargas salen de la arena de páginas
+
+using namespace std;
+
+// Páginas de 4 KiB contra páginas de 2 MiB: mide las cargas de JerarquiaCache (Merge Sort,
+// inserción en un BST aleatorio y recorrido de una lista dispersa) con las entradas, los
+// búferes y los nodos en una arena de cada tipo (PaginasMemoria.h), y para cada n imprime el
+// tiempo por operación, la aceleración con páginas grandes y los fallos de dTLB por operación.
+// Sin permiso para perf_event_open los fallos quedan en "n/d". Las demás opciones son las del
+// arnés en ConfiguracionBarrido.h (repeticiones_max, presupuesto_ms, estado_cache, ...).
+
+void imprimirUso() {
+    cerr << "Uso: CompararPaginas [--tamanos E] [--cargas mezcla,bst,lista] [--clave valor ...]\n"
+            "  --tamanos E   geom:inicio:fin:puntos | lin:inicio:fin:paso | a,b,c (geom:10000:10000000:4)\n"
+            "  --cargas L    mezcla,bst,lista (todas)\n"
+            "  Las páginas de 2 MiB salen de hugetlbfs si hay páginas reservadas (vm.nr_hugepages) y si no\n"
+            "  de THP (transparent_hugepage en madvise o always)" << endl;
+}
+
+// Fallos de dTLB por operación de la carga; -1 si el contador no está disponible
+double fallosTLBPorOperacion(const CargaCache& carga, int n, const EstadisticasCelda& celda) {
+    if (!celda.contadores.disponible(EventoFallosTLB)) return -1;
+    return celda.contadores.valores[EventoFallosTLB] / carga.operaciones(n);
+}
+
+void imprimirFallos(double fallos) {
+    if (fallos < 0) cout << "n/d";
+    else cout << fallos;
+}
+
+int main(int argc, char* argv[]) {
+    ConfiguracionBarrido barrido;
+    leerEscalera("geom:10000:10000000:4", barrido.tamanos);
+    barrido.arnes.repeticionesMinimas = 3;
+    barrido.arnes.repeticionesMaximas = 10;
+    barrido.arnes.presupuestoNs = 20000000000LL;
+    vector<string> nombresCargas;
+    for (int i = 1; i < argc; i++) {
+        string clave = argv[i];
+        if (clave.rfind("--", 0) != 0 || i + 1 >= argc) {
+            imprimirUso();
+            return 1;
+        }
+        string valor = argv[++i];
+        clave = clave.substr(2);
+        replace(clave.begin(), clave.end(), '-', '_');
+        bool valido;
+        if (clave == "cargas") valido = !(nombresCargas = separarLista(valor)).empty();
+        else valido = aplicarOpcionBarrido(barrido, clave, valor);
+        if (!valido) {
+            cerr << "Opción no válida: --" << clave << " " << valor << endl;
+            imprimirUso();
+            return 1;
+        }
+    }
+
+    vector<CargaCache> cargas;
+    for (CargaCache& carga : definirCargas(TipoPaginas::Normales)) {
+        if (nombresCargas.empty() || find(nombresCargas.begin(), nombresCargas.end(), carga.nombre) != nombresCargas.end()) cargas.push_back(move(carga));
+    }
+    if (cargas.empty()) {
+        cerr << "Ninguna carga coincide con --cargas (mezcla, bst, lista)" << endl;
+        return 1;
+    }
+
+    string grandes = paginasGrandesDisponibles();
+    cout << "Páginas de 2 MiB: " << grandes << endl;
+    if (grandes == "ninguna") cerr << "El kernel no dio páginas de 2 MiB (¿transparent_hugepage en never?): las dos arenas usarán páginas de 4 KiB" << endl;
+
+    ConfiguracionArnes normales = barrido.arnes, grandesArnes = barrido.arnes;
+    normales.paginas = TipoPaginas::Normales;
+    grandesArnes.paginas = TipoPaginas::Grandes;
+    for (const CargaCache& carga : cargas) {
+        vector<double> tamanosMedidos, medianas;
+        for (int n : barrido.tamanos) {
+            // El presupuesto se predice con la serie de 4 KiB, la más lenta
+            double prediccionNs;
+            if (excederiaPresupuesto(tamanosMedidos, medianas, n, normales, prediccionNs)) {
+                cout << carga.nombre << ": se omiten los tamaños desde n=" << n << " (se predicen " << prediccionNs
+                     << " ns por repetición, excede el presupuesto)" << endl;
+                break;
+            }
+            EstadisticasCelda celda4k = carga.medir(n, normales);
+            EstadisticasCelda celda2m = carga.medir(n, grandesArnes);
+            tamanosMedidos.push_back(n);
+            medianas.push_back(celda4k.mediana);
+
+            double operaciones = carga.operaciones(n);
+            cout << carga.nombre << "\tn=" << n << "\tbytes=" << static_cast<long long>(n) * carga.bytesPorElemento << "\tns/"
+                 << carga.operacion << " 4k=" << celda4k.mediana / operaciones << " 2m=" << celda2m.mediana / operaciones
+                 << "\taceleracion=" << (celda2m.mediana > 0 ? celda4k.mediana / celda2m.mediana : 0) << "\tfallos dTLB/" << carga.operacion
+                 << " 4k=";
+            imprimirFallos(fallosTLBPorOperacion(carga, n, celda4k));
+            cout << " 2m=";
+            imprimirFallos(fallosTLBPorOperacion(carga, n, celda2m));
+            cout << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "AlmacenResultados.h"    // Historial de versiones y comparación
+#include "ConfiguracionBarrido.h" // Para leerNumero
+
+using namespace std;
+
+// Compara dos versiones del almacén que llena BenchmarkConsola --almacen y marca las celdas
+// con regresiones (o mejoras) significativas. Sale con código 2 si hay alguna regresión, para
+// poder usarlo en un trabajo automático.
+
+void imprimirUso() {
+    cerr << "Uso: CompararResultados almacen [--base commit] [--nueva commit] [--alfa A] [--umbral U] [--listar]\n"
+            "  --base, --nueva  prefijo del commit de cada versión (por defecto: la última versión y la\n"
+            "                   anterior medida en la misma CPU)\n"
+            "  --alfa A         nivel de significancia de la prueba U de Mann-Whitney (0.01)\n"
+            "  --umbral U       cambio relativo mínimo de la mediana para marcar la celda (0.05)\n"
+            "  --listar         solo lista las versiones del almacén" << endl;
+}
+
+// Última versión cuyo commit empieza con el prefijo; -1 si no hay
+int buscarVersion(const vector<EntornoMedicion>& versiones, const string& prefijo) {
+    for (int i = static_cast<int>(versiones.size()) - 1; i >= 0; i--) {
+        if (versiones[i].commit.rfind(prefijo, 0) == 0) return i;
+    }
+    return -1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        imprimirUso();
+        return 1;
+    }
+    string ruta = argv[1], prefijoBase, prefijoNueva;
+    double alfa = 0.01, umbral = 0.05;
+    bool listar = false;
+    for (int i = 2; i < argc; i++) {
+        string argumento = argv[i];
+        if (argumento == "--listar") {
+            listar = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            imprimirUso();
+            return 1;
+        }
+        string valor = argv[++i];
+        bool valido = true;
+        if (argumento == "--base") prefijoBase = valor;
+        else if (argumento == "--nueva") prefijoNueva = valor;
+        else if (argumento == "--alfa") valido = leerNumero(valor, alfa) && alfa > 0 && alfa < 1;
+        else if (argumento == "--umbral") valido = leerNumero(valor, umbral) && umbral >= 0;
+        else valido = false;
+        if (!valido) {
+            imprimirUso();
+            return 1;
+        }
+    }
+
+    vector<RegistroAlmacen> registros = leerAlmacen(ruta);
+    vector<EntornoMedicion> versiones = versionesAlmacen(registros);
+    if (listar) {
+        for (size_t i = 0; i < versiones.size(); i++) cout << i << "\t" << versiones[i].clave() << endl;
+        return 0;
+    }
+    if (versiones.size() < 2) {
+        cerr << ruta << ": se necesitan al menos dos versiones para comparar (hay " << versiones.size() << ")" << endl;
+        return 1;
+    }
+
+    int nueva = prefijoNueva.empty() ? static_cast<int>(versiones.size()) - 1 : buscarVersion(versiones, prefijoNueva);
+    int base = -1;
+    if (!prefijoBase.empty()) {
+        base = buscarVersion(versiones, prefijoBase);
+    } else if (nueva >= 0) {
+        for (int i = nueva - 1; i >= 0 && base < 0; i--) {
+            if (versiones[i].cpu == versiones[nueva].cpu) base = i;
+        }
+    }
+    if (base < 0 || nueva < 0 || base == nueva) {
+        cerr << "No se encontraron dos versiones distintas para comparar (ver --listar)" << endl;
+        return 1;
+    }
+    if (versiones[base].cpu != versiones[nueva].cpu) {
+        cerr << "Aviso: las versiones se midieron en CPUs distintas" << endl;
+    }
+
+    cout << "Base:  " << versiones[base].clave() << "\nNueva: " << versiones[nueva].clave() << "\n" << endl;
+    vector<ComparacionCelda> comparaciones = compararVersiones(registros, versiones[base], versiones[nueva], alfa, umbral);
+    int regresiones = 0, mejoras = 0, insuficientes = 0;
+    cout << fixed << setprecision(3);
+    for (const ComparacionCelda& comparacion : comparaciones) {
+        const auto& [algoritmo, caso, n] = comparacion.celda;
+        const char* marca = comparacion.regresion ? "REGRESION" : comparacion.mejora ? "mejora" : comparacion.insuficiente ? "insuficientes muestras" : "";
+        cout << algoritmo << "\t" << caso << "\tn=" << n << "\t" << setprecision(0) << comparacion.medianaBase << " -> "
+             << comparacion.medianaNueva << " ns\t" << setprecision(1) << showpos << 100 * comparacion.cambioRelativo << "%" << noshowpos
+             << "\tp=" << setprecision(4) << comparacion.prueba.p << "\tdelta=" << setprecision(2) << comparacion.prueba.efecto
+             << "\t" << marca << endl;
+        regresiones += comparacion.regresion;
+        mejoras += comparacion.mejora;
+        insuficientes += comparacion.insuficiente;
+    }
+    cout << "\n" << comparaciones.size() << " celdas comparadas, " << regresiones << " regresiones, " << mejoras << " mejoras" << endl;
+    if (insuficientes > 0) {
+        cout << insuficientes << " celdas con muy pocas muestras para llegar a p < " << alfa
+             << ": no se pueden marcar (subir --repeticiones-min al medir)" << endl;
+    }
+    return regresiones > 0 ? 2 : 0;
+}
@@ -0,0 +1,258 @@
+#ifndef CONFIGURACIONBARRIDO_H
+#define CONFIGURACIONBARRIDO_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AjusteComplejidad.h"
+#include "ArnesBenchmark.h"
+#include "GeneradoresEntrada.h"
+
+// Configuración declarativa de un barrido: tamaños (escaleras geométricas o lineales, con
+// puntos extra alrededor de los tamaños de caché), algoritmos, casos, repeticiones,
+// presupuesto por celda y semilla. Se lee de un archivo "clave = valor" (# para comentarios)
+// o de opciones "--clave valor" en la línea de comandos. Ejemplo:
+//
+//   tamanos = geom:10:100000000:50     # 50 puntos geométricos de 10 a 10^8
+//   densificar_caches = si             # + puntos alrededor de L1, L2 y L3
+//   algoritmos = mezcla,bst
+//   casos = peor,promedio
+//   repeticiones_max = 15
+//   presupuesto_ms = 5000
+//   semilla = 42
+//   cache_entradas = cache             # entradas pregeneradas y mapeadas
+//   cache_resultados = resultados      # celdas ya medidas con el mismo código
+//   estado_cache = frio                # actual, caliente, frio o frio_tlb (EstadoCache.h)
+//   paginas = 2m                       # sistema, 4k o 2m (PaginasMemoria.h)
+
+struct ConfiguracionBarrido {
+    std::vector<int> tamanos = {100, 1000, 5000, 10000, 50000};
+    bool densificarCaches = false;
+    int bytesPorElemento = sizeof(int); // Para ubicar los tamaños de caché en elementos
+    std::vector<std::string> algoritmos; // Vacío: todos
+    std::vector<std::string> casos = {"mejor", "peor", "promedio"}; // Distribuciones (GeneradoresEntrada.h); vacío o "todos": todas
+    ConfiguracionArnes arnes;
+    unsigned semilla = semillaEntradas;
+    std::string directorioCache; // Caché de entradas (CacheEntradas.h); vacío: generar en cada corrida
+    std::string directorioResultados; // Caché de resultados (CacheResultados.h); vacío: medir todo
+    std::vector<std::string> refrescar; // Algoritmos que se vuelven a medir aunque estén en la caché ("todos")
+};
+
+inline std::vector<std::string> separarLista(const std::string& texto) {
+    std::vector<std::string> partes;
+    std::stringstream flujo(texto);
+    std::string parte;
+    while (std::getline(flujo, parte, ',')) {
+        parte.erase(0, parte.find_first_not_of(" \t"));
+        parte.erase(parte.find_last_not_of(" \t") + 1);
+        if (!parte.empty()) partes.push_back(parte);
+    }
+    return partes;
+}
+
+// Convierte "1e8", "5000", ... en número; devuelve false si no es un número completo
+inline bool leerNumero(const std::string& texto, double& valor) {
+    try {
+        size_t leidos = 0;
+        valor = std::stod(texto, &leidos);
+        return leidos == texto.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// Escaleras de tamaños:
+//   geom:inicio:fin:puntos  puntos espaciados geométricamente (redondeados, sin repetidos)
+//   lin:inicio:fin:paso     inicio, inicio + paso, ... hasta fin
+//   a,b,c                   lista explícita
+inline bool leerEscalera(const std::string& especificacion, std::vector<int>& tamanos) {
+    std::vector<int> resultado;
+    if (especificacion.rfind("geom:", 0) == 0 || especificacion.rfind("lin:", 0) == 0) {
+        std::vector<std::string> partes;
+        std::stringstream flujo(especificacion);
+        std::string parte;
+        while (std::getline(flujo, parte, ':')) partes.push_back(parte);
+        double inicio, fin, tercero;
+        if (partes.size() != 4 || !leerNumero(partes[1], inicio) || !leerNumero(partes[2], fin) || !leerNumero(partes[3], tercero)) return false;
+        if (inicio < 1 || fin < inicio || fin > 2e9 || tercero <= 0) return false;
+
+        if (partes[0] == "geom") {
+            int puntos = static_cast<int>(tercero);
+            if (puntos < 2) return false;
+            double razon = std::pow(fin / inicio, 1.0 / (puntos - 1));
+            for (int i = 0; i < puntos; i++) resultado.push_back(static_cast<int>(std::llround(inicio * std::pow(razon, i))));
+        } else {
+            for (double n = inicio; n <= fin; n += tercero) resultado.push_back(static_cast<int>(std::llround(n)));
+        }
+    } else {
+        for (const std::string& parte : separarLista(especificacion)) {
+            double n;
+            if (!leerNumero(parte, n) || n < 1 || n > 2e9) return false;
+            resultado.push_back(static_cast<int>(n));
+        }
+    }
+    if (resultado.empty()) return false;
+    std::sort(resultado.begin(), resultado.end());
+    resultado.erase(std::unique(resultado.begin(), resultado.end()), resultado.end());
+    tamanos = resultado;
+    return true;
+}
+
+// Agrega puntos entre la mitad y el doble de cada tamaño de caché (en elementos)
+inline void densificarAlrededorDeCaches(std::vector<int>& tamanos, int bytesPorElemento) {
+    const double factores[] = {0.5, 0.7, 0.85, 0.95, 1.0, 1.05, 1.15, 1.3, 1.5, 2.0};
+    for (long long bytes : tamanosCache()) {
+        for (double factor : factores) {
+            long long n = std::llround(bytes * factor / std::max(1, bytesPorElemento));
+            if (n >= 1 && n <= 2000000000LL) tamanos.push_back(static_cast<int>(n));
+        }
+    }
+    std::sort(tamanos.begin(), tamanos.end());
+    tamanos.erase(std::unique(tamanos.begin(), tamanos.end()), tamanos.end());
+}
+
+inline bool leerSiNo(const std::string& valor, bool& resultado) {
+    if (valor == "si" || valor == "1" || valor == "true") resultado = true;
+    else if (valor == "no" || valor == "0" || valor == "false") resultado = false;
+    else return false;
+    return true;
+}
+
+// Aplica una clave de configuración; devuelve false si la clave o el valor no son válidos
+inline bool aplicarOpcionBarrido(ConfiguracionBarrido& barrido, const std::string& clave, const std::string& valor) {
+    double numero = 0;
+    bool esNumero = leerNumero(valor, numero);
+    if (clave == "tamanos") return leerEscalera(valor, barrido.tamanos);
+    if (clave == "densificar_caches") return leerSiNo(valor, barrido.densificarCaches);
+    if (clave == "contadores") return leerSiNo(valor, barrido.arnes.contadoresHardware);
+    if (clave == "memoria") return leerSiNo(valor, barrido.arnes.memoria);
+    if (clave == "estado_cache") return leerEstadoCache(valor, barrido.arnes.estadoCache);
+    if (clave == "paginas") return leerTipoPaginas(valor, barrido.arnes.paginas);
+    if (clave == "cache_entradas") {
+        barrido.directorioCache = valor;
+        return true;
+    }
+    if (clave == "cache_resultados") {
+        barrido.directorioResultados = valor;
+        return true;
+    }
+    if (clave == "refrescar") {
+        barrido.refrescar = separarLista(valor);
+        return true;
+    }
+    if (clave == "algoritmos") {
+        barrido.algoritmos = separarLista(valor);
+        return true;
+    }
+    if (clave == "casos") {
+        barrido.casos = valor == "todos" ? std::vector<std::string>() : separarLista(valor);
+        return true;
+    }
+    if (!esNumero || numero < 0) return false;
+    if (clave == "bytes_por_elemento") barrido.bytesPorElemento = static_cast<int>(numero);
+    else if (clave == "calentamiento") barrido.arnes.calentamiento = static_cast<int>(numero);
+    else if (clave == "repeticiones_min") barrido.arnes.repeticionesMinimas = std::max(1, static_cast<int>(numero));
+    else if (clave == "repeticiones_max") barrido.arnes.repeticionesMaximas = std::max(1, static_cast<int>(numero));
+    else if (clave == "ancho_relativo") barrido.arnes.anchoRelativoMaximo = numero;
+    else if (clave == "presupuesto_ms") barrido.arnes.presupuestoNs = static_cast<long long>(numero * 1e6);
+    else if (clave == "lote_minimo_ns") barrido.arnes.loteMinimoNs = numero;
+    else if (clave == "semilla") barrido.semilla = static_cast<unsigned>(numero);
+    else return false;
+    return true;
+}
+
+// Lee un archivo "clave = valor"; en caso de error deja la línea problemática en error
+inline bool leerArchivoBarrido(const std::string& ruta, ConfiguracionBarrido& barrido, std::string& error) {
+    std::ifstream archivo(ruta);
+    if (!archivo) {
+        error = "No se pudo abrir " + ruta;
+        return false;
+    }
+    std::string linea;
+    for (int numeroLinea = 1; std::getline(archivo, linea); numeroLinea++) {
+        linea = linea.substr(0, linea.find('#'));
+        size_t igual = linea.find('=');
+        if (linea.find_first_not_of(" \t\r") == std::string::npos) continue;
+        if (igual == std::string::npos) {
+            error = ruta + ":" + std::to_string(numeroLinea) + ": se esperaba clave = valor";
+            return false;
+        }
+        std::string clave = linea.substr(0, igual), valor = linea.substr(igual + 1);
+        for (std::string* texto : {&clave, &valor}) {
+            texto->erase(0, texto->find_first_not_of(" \t"));
+            texto->erase(texto->find_last_not_of(" \t\r") + 1);
+        }
+        if (!aplicarOpcionBarrido(barrido, clave, valor)) {
+            error = ruta + ":" + std::to_string(numeroLinea) + ": opción no válida '" + clave + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tamaños finales del barrido (con los puntos de caché si se pidieron)
+inline std::vector<int> tamanosBarrido(const ConfiguracionBarrido& barrido) {
+    std::vector<int> tamanos = barrido.tamanos;
+    if (barrido.densificarCaches) densificarAlrededorDeCaches(tamanos, barrido.bytesPorElemento);
+    return tamanos;
+}
+
+// Tamaños para los programas gráficos: toma "--barrido archivo" y "--tamanos E" de la línea de
+// comandos (ignora los demás argumentos, que son de Qt); si no hay o no son válidos, usa los dados
+inline std::vector<int> tamanosDeArgumentos(int argc, char* argv[], const std::vector<int>& porDefecto) {
+    ConfiguracionBarrido barrido;
+    barrido.tamanos = porDefecto;
+    for (int i = 1; i + 1 < argc; i++) {
+        std::string argumento = argv[i], valor = argv[i + 1], error;
+        bool valido = true;
+        if (argumento == "--barrido") valido = leerArchivoBarrido(valor, barrido, error);
+        else if (argumento == "--tamanos") valido = leerEscalera(valor, barrido.tamanos);
+        else continue;
+        if (!valido) {
+            std::cerr << (error.empty() ? "Tamaños no válidos: " + valor : error) << "; se usan los tamaños por defecto" << std::endl;
+            return porDefecto;
+        }
+        i++;
+    }
+    return tamanosBarrido(barrido);
+}
+
+inline bool incluidoEnBarrido(const std::vector<std::string>& seleccion, const std::string& nombre) {
+    return seleccion.empty() || std::find(seleccion.begin(), seleccion.end(), nombre) != seleccion.end();
+}
+
+// Si las celdas del algoritmo se vuelven a medir aunque estén en la caché de resultados
+inline bool refrescarAlgoritmo(const ConfiguracionBarrido& barrido, const std::string& algoritmo) {
+    return std::any_of(barrido.refrescar.begin(), barrido.refrescar.end(), [&](const std::string& nombre) { return nombre == "todos" || nombre == algoritmo; });
+}
+
+// Semilla reproducible y distinta para cada celda
+inline unsigned semillaCelda(unsigned semilla, int n, int indiceCaso) {
+    return static_cast<unsigned>(mezclar64(semilla ^ mezclar64((static_cast<uint64_t>(n) << 8) ^ static_cast<uint64_t>(indiceCaso))));
+}
+
+// Predice el tiempo de la celda de tamaño n con la ley de potencias ajustada a las últimas
+// celdas medidas de la misma serie (algoritmo, caso). La celda necesita al menos el
+// calentamiento y las repeticiones mínimas completas; si eso excede el presupuesto, se omite.
+inline bool excederiaPresupuesto(const std::vector<double>& tamanosMedidos, const std::vector<double>& medianas, int n,
+                                 const ConfiguracionArnes& arnes, double& prediccionNs) {
+    const size_t puntosAjuste = 4;
+    prediccionNs = 0;
+    if (tamanosMedidos.size() < 2) return false;
+    size_t desde = tamanosMedidos.size() > puntosAjuste ? tamanosMedidos.size() - puntosAjuste : 0;
+    std::vector<double> x(tamanosMedidos.begin() + desde, tamanosMedidos.end());
+    std::vector<double> y(medianas.begin() + desde, medianas.end());
+    AjustePotencia potencia = ajustarPotencia(x, y);
+    if (!potencia.valido) return false;
+    // El exponente no baja de 0: un ajuste ruidoso en tamaños chicos no debe predecir tiempos decrecientes
+    double exponente = std::max(0.0, potencia.exponente);
+    prediccionNs = y.back() * std::pow(n / x.back(), exponente);
+    return prediccionNs * (arnes.calentamiento + arnes.repeticionesMinimas) > arnes.presupuestoNs;
+}
+
+#endif // CONFIGURACIONBARRIDO_H
@@ -0,0 +1,212 @@
+#ifndef CONTADORHARDWARE_H
+#define CONTADORHARDWARE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Contador de hardware para un único evento (por defecto, fallos de predicción de saltos).
+// Si el sistema no permite leer contadores (perf_event_paranoid, contenedores, otro S.O.)
+// el contador queda deshabilitado y leer() devuelve -1.
+class ContadorHardware {
+public:
+#ifdef __linux__
+    explicit ContadorHardware(uint32_t tipo = PERF_TYPE_HARDWARE, uint64_t config = PERF_COUNT_HW_BRANCH_MISSES) {
+        perf_event_attr atributos;
+        memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = tipo;
+        atributos.config = config;
+        atributos.disabled = 1;
+        atributos.exclude_kernel = 1;
+        atributos.exclude_hv = 1;
+        descriptor = static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0));
+    }
+
+    ~ContadorHardware() {
+        if (descriptor >= 0) close(descriptor);
+    }
+
+    bool disponible() const { return descriptor >= 0; }
+
+    // Reinicia y habilita el contador
+    void iniciar() {
+        if (descriptor < 0) return;
+        ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+        ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    void detener() {
+        if (descriptor >= 0) ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    long long leer() const {
+        long long valor = 0;
+        if (descriptor < 0 || ::read(descriptor, &valor, sizeof(valor)) != sizeof(valor)) return -1;
+        return valor;
+    }
+#else
+    ContadorHardware() {}
+    bool disponible() const { return false; }
+    void iniciar() {}
+    void detener() {}
+    long long leer() const { return -1; }
+#endif
+
+    ContadorHardware(const ContadorHardware&) = delete;
+    ContadorHardware& operator=(const ContadorHardware&) = delete;
+
+private:
+    int descriptor = -1;
+};
+
+// Eventos del grupo de contadores
+enum EventoContador {
+    EventoCiclos,
+    EventoInstrucciones,
+    EventoFallosL1,      // Fallos de lectura en la caché L1 de datos
+    EventoFallosLLC,     // Fallos en la caché de último nivel
+    EventoFallosSalto,   // Fallos de predicción de saltos
+    EventoFallosTLB,     // Fallos de lectura en la dTLB
+    NumEventosContador
+};
+
+inline const char* nombreEvento(int evento) {
+    static const char* nombres[NumEventosContador] = {"ciclos", "instrucciones", "fallos L1d", "fallos LLC",
+                                                      "fallos de salto", "fallos dTLB"};
+    return nombres[evento];
+}
+
+// Nombre del evento como identificador, para columnas CSV y claves JSON
+inline const char* claveEvento(int evento) {
+    static const char* claves[NumEventosContador] = {"ciclos", "instrucciones", "fallos_l1d", "fallos_llc",
+                                                     "fallos_salto", "fallos_dtlb"};
+    return claves[evento];
+}
+
+// Valores de una lectura del grupo; -1 indica que el evento no está disponible
+struct LecturaContadores {
+    long long valores[NumEventosContador];
+
+    LecturaContadores() { std::fill(valores, valores + NumEventosContador, -1LL); }
+
+    bool disponible(int evento) const { return valores[evento] >= 0; }
+
+    bool algunoDisponible() const {
+        return std::any_of(valores, valores + NumEventosContador, [](long long v) { return v >= 0; });
+    }
+
+    // Instrucciones por ciclo
+    double ipc() const {
+        if (!disponible(EventoCiclos) || !disponible(EventoInstrucciones) || valores[EventoCiclos] == 0) return -1;
+        return static_cast<double>(valores[EventoInstrucciones]) / valores[EventoCiclos];
+    }
+
+    double porElemento(int evento, long long n) const {
+        if (!disponible(evento) || n <= 0) return -1;
+        return static_cast<double>(valores[evento]) / n;
+    }
+};
+
+// Mediana evento por evento de varias lecturas (las repeticiones de una celda)
+inline LecturaContadores medianaContadores(const std::vector<LecturaContadores>& lecturas) {
+    LecturaContadores resultado;
+    for (int e = 0; e < NumEventosContador; e++) {
+        std::vector<long long> valores;
+        for (const LecturaContadores& lectura : lecturas) {
+            if (lectura.disponible(e)) valores.push_back(lectura.valores[e]);
+        }
+        if (valores.empty()) continue;
+        std::nth_element(valores.begin(), valores.begin() + valores.size() / 2, valores.end());
+        resultado.valores[e] = valores[valores.size() / 2];
+    }
+    return resultado;
+}
+
+// Grupo de contadores de hardware que se habilitan y deshabilitan juntos alrededor de una
+// región medida. Los eventos que el procesador o el kernel no permiten se omiten; si no se
+// abre ninguno (perf_event_paranoid, contenedores, otro S.O.) todas las lecturas son -1.
+class GrupoContadores {
+public:
+#ifdef __linux__
+    GrupoContadores() {
+        const uint64_t cacheL1Lectura = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const uint64_t tlbLectura = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const struct { uint32_t tipo; uint64_t config; } eventos[NumEventosContador] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, cacheL1Lectura},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE, tlbLectura},
+        };
+
+        for (int e = 0; e < NumEventosContador; e++) {
+            perf_event_attr atributos;
+            memset(&atributos, 0, sizeof(atributos));
+            atributos.size = sizeof(atributos);
+            atributos.type = eventos[e].tipo;
+            atributos.config = eventos[e].config;
+            atributos.disabled = lider < 0 ? 1 : 0; // Los miembros siguen al líder
+            atributos.exclude_kernel = 1;
+            atributos.exclude_hv = 1;
+            atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            descriptores[e] = static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, lider, 0));
+            if (lider < 0 && descriptores[e] >= 0) lider = descriptores[e];
+        }
+    }
+
+    ~GrupoContadores() {
+        for (int descriptor : descriptores) {
+            if (descriptor >= 0) close(descriptor);
+        }
+    }
+
+    bool disponible() const { return lider >= 0; }
+
+    void iniciar() {
+        if (lider < 0) return;
+        ioctl(lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    void detener() {
+        if (lider >= 0) ioctl(lider, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    // Si el kernel multiplexó los contadores, el valor se escala por tiempo habilitado/corriendo
+    LecturaContadores leer() const {
+        LecturaContadores lectura;
+        for (int e = 0; e < NumEventosContador; e++) {
+            uint64_t datos[3]; // valor, tiempo habilitado, tiempo corriendo
+            if (descriptores[e] < 0 || ::read(descriptores[e], datos, sizeof(datos)) != sizeof(datos)) continue;
+            if (datos[2] == 0) continue;
+            lectura.valores[e] = static_cast<long long>(datos[2] < datos[1] ? static_cast<double>(datos[0]) * datos[1] / datos[2] : datos[0]);
+        }
+        return lectura;
+    }
+#else
+    GrupoContadores() {}
+    bool disponible() const { return false; }
+    void iniciar() {}
+    void detener() {}
+    LecturaContadores leer() const { return {}; }
+#endif
+
+    GrupoContadores(const GrupoContadores&) = delete;
+    GrupoContadores& operator=(const GrupoContadores&) = delete;
+
+private:
+    int lider = -1;
+    int descriptores[NumEventosContador] = {-1, -1, -1, -1, -1, -1};
+};
+
+#endif // CONTADORHARDWARE_H
@@ -0,0 +1,165 @@
+#ifndef ESTADISTICAS_H
+#define ESTADISTICAS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Estadísticos robustos para muestras de tiempo: en mediciones de rendimiento la distribución
+// tiene cola a la derecha (interrupciones, cambios de contexto), por eso se reporta mediana,
+// percentiles y MAD en lugar de media y desviación estándar.
+
+// Percentil p (0..1) con interpolación lineal entre muestras ordenadas
+inline double percentilOrdenado(const std::vector<double>& ordenadas, double p) {
+    if (ordenadas.empty()) return 0;
+    double posicion = p * (ordenadas.size() - 1);
+    size_t abajo = static_cast<size_t>(std::floor(posicion));
+    size_t arriba = std::min(abajo + 1, ordenadas.size() - 1);
+    double fraccion = posicion - abajo;
+    return ordenadas[abajo] * (1 - fraccion) + ordenadas[arriba] * fraccion;
+}
+
+inline double percentil(std::vector<double> muestras, double p) {
+    std::sort(muestras.begin(), muestras.end());
+    return percentilOrdenado(muestras, p);
+}
+
+inline double mediana(const std::vector<double>& muestras) {
+    return percentil(muestras, 0.5);
+}
+
+// Desviación absoluta mediana: mediana(|x - mediana(x)|)
+inline double desviacionAbsolutaMediana(const std::vector<double>& muestras) {
+    double centro = mediana(muestras);
+    std::vector<double> desviaciones(muestras.size());
+    for (size_t i = 0; i < muestras.size(); i++) {
+        desviaciones[i] = std::fabs(muestras[i] - centro);
+    }
+    return mediana(desviaciones);
+}
+
+struct IntervaloConfianza {
+    double inferior;
+    double superior;
+};
+
+// Intervalo de confianza bootstrap (percentil) de la mediana. La semilla es fija para que
+// el mismo conjunto de muestras produzca siempre el mismo intervalo.
+inline IntervaloConfianza intervaloBootstrapMediana(const std::vector<double>& muestras, int remuestreos = 1000,
+                                                    double confianza = 0.95, uint32_t semilla = 12345) {
+    if (muestras.size() < 2) {
+        double valor = muestras.empty() ? 0 : muestras[0];
+        return {valor, valor};
+    }
+    std::mt19937 generador(semilla);
+    std::uniform_int_distribution<size_t> indice(0, muestras.size() - 1);
+    std::vector<double> medianas(remuestreos);
+    std::vector<double> remuestra(muestras.size());
+    for (int r = 0; r < remuestreos; r++) {
+        for (double& valor : remuestra) {
+            valor = muestras[indice(generador)];
+        }
+        medianas[r] = mediana(remuestra);
+    }
+    std::sort(medianas.begin(), medianas.end());
+    double alfa = (1 - confianza) / 2;
+    return {percentilOrdenado(medianas, alfa), percentilOrdenado(medianas, 1 - alfa)};
+}
+
+// Prueba U de Mann-Whitney (dos colas) para decidir si dos conjuntos de muestras vienen de la
+// misma distribución. No supone normalidad, así que sirve para tiempos con cola a la derecha.
+// Con hasta maximoMuestrasExacta por lado el valor p sale de la distribución exacta de la suma
+// de rangos (condicionada a los empates observados); la aproximación normal con corrección de
+// continuidad no baja de p = 0.0122 con 5 contra 5. Con más muestras, aproximación normal con
+// corrección por empates y por continuidad.
+inline constexpr size_t maximoMuestrasExacta = 20;
+
+struct PruebaMannWhitney {
+    double u = 0;      // U de las muestras nuevas: pares (base, nueva) con nueva > base (empates cuentan 1/2)
+    double z = 0;      // Solo con la aproximación normal
+    double p = 1;      // Valor p de dos colas
+    double pMinimo = 1; // Menor p alcanzable con estos tamaños (y empates): si no baja de alfa, la prueba no puede rechazar
+    double efecto = 0; // Delta de Cliff en [-1, 1]: positivo si las nuevas tienden a ser mayores
+    bool exacta = false;
+};
+
+// Distribución exacta de la suma de rangos (duplicados, para que los rangos promedio de los
+// empates sean enteros) de m elementos elegidos entre los rangos dados: conteos[s] es la
+// cantidad de subconjuntos de tamaño m con suma s
+inline std::vector<double> conteosSumaRangos(const std::vector<int>& rangosDobles, size_t m) {
+    int sumaMaxima = 0;
+    for (int rango : rangosDobles) sumaMaxima += rango;
+    // tabla[k][s]: subconjuntos de tamaño k con suma s entre los rangos ya vistos
+    std::vector<std::vector<double>> tabla(m + 1, std::vector<double>(sumaMaxima + 1, 0));
+    tabla[0][0] = 1;
+    for (size_t i = 0; i < rangosDobles.size(); i++) {
+        for (size_t k = std::min(m, i + 1); k >= 1; k--) {
+            for (int suma = sumaMaxima; suma >= rangosDobles[i]; suma--) tabla[k][suma] += tabla[k - 1][suma - rangosDobles[i]];
+        }
+    }
+    return tabla[m];
+}
+
+inline PruebaMannWhitney pruebaMannWhitney(const std::vector<double>& base, const std::vector<double>& nuevas) {
+    PruebaMannWhitney prueba;
+    size_t n1 = base.size(), n2 = nuevas.size(), total = n1 + n2;
+    if (n1 == 0 || n2 == 0) return prueba;
+
+    // Rangos promedio de la muestra combinada (segundo = true para las nuevas)
+    std::vector<std::pair<double, bool>> combinadas;
+    for (double valor : base) combinadas.push_back({valor, false});
+    for (double valor : nuevas) combinadas.push_back({valor, true});
+    std::sort(combinadas.begin(), combinadas.end());
+    double sumaRangosNuevas = 0, correccionEmpates = 0;
+    std::vector<int> rangosDobles;
+    for (size_t i = 0; i < total;) {
+        size_t j = i;
+        while (j < total && combinadas[j].first == combinadas[i].first) j++;
+        double rango = (i + 1 + j) / 2.0;
+        for (size_t k = i; k < j; k++) {
+            if (combinadas[k].second) sumaRangosNuevas += rango;
+            rangosDobles.push_back(static_cast<int>(i + 1 + j));
+        }
+        double empatados = static_cast<double>(j - i);
+        correccionEmpates += empatados * empatados * empatados - empatados;
+        i = j;
+    }
+
+    prueba.u = sumaRangosNuevas - n2 * (n2 + 1) / 2.0;
+    double producto = static_cast<double>(n1) * n2;
+    prueba.efecto = 2 * prueba.u / producto - 1;
+
+    if (n1 <= maximoMuestrasExacta && n2 <= maximoMuestrasExacta) {
+        std::vector<double> conteos = conteosSumaRangos(rangosDobles, n2);
+        int observada = static_cast<int>(std::lround(2 * sumaRangosNuevas));
+        double subconjuntos = 0, inferior = 0, superior = 0;
+        int sumaMinima = -1, sumaMaxima = 0;
+        for (int suma = 0; suma < static_cast<int>(conteos.size()); suma++) {
+            if (conteos[suma] == 0) continue;
+            subconjuntos += conteos[suma];
+            if (suma <= observada) inferior += conteos[suma];
+            if (suma >= observada) superior += conteos[suma];
+            if (sumaMinima < 0) sumaMinima = suma;
+            sumaMaxima = suma;
+        }
+        prueba.exacta = true;
+        prueba.p = std::min(1.0, 2 * std::min(inferior, superior) / subconjuntos);
+        prueba.pMinimo = sumaMinima == sumaMaxima ? 1 : std::min(1.0, 2 * std::min(conteos[sumaMinima], conteos[sumaMaxima]) / subconjuntos);
+        return prueba;
+    }
+    // Sin empates el extremo es un solo subconjunto de los C(total, n2)
+    prueba.pMinimo = std::min(1.0, 2 * std::exp(std::lgamma(n1 + 1.0) + std::lgamma(n2 + 1.0) - std::lgamma(total + 1.0)));
+
+    double media = producto / 2;
+    double varianza = producto / 12 * ((total + 1) - (total > 1 ? correccionEmpates / (static_cast<double>(total) * (total - 1)) : 0));
+    if (varianza <= 0) return prueba; // Todas las muestras iguales
+    double diferencia = std::max(0.0, std::fabs(prueba.u - media) - 0.5);
+    prueba.z = (prueba.u > media ? 1 : -1) * diferencia / std::sqrt(varianza);
+    prueba.p = std::erfc(std::fabs(prueba.z) / std::sqrt(2.0));
+    return prueba;
+}
+
+#endif // ESTADISTICAS_H
@@ -0,0 +1,169 @@
+#ifndef ESTADOCACHE_H
+#define ESTADOCACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(__unix__)
+#include <sys/mman.h>
+#endif
+
+// Estado de las cachés y de la TLB al empezar cada muestra del arnés (ArnesBenchmark.h):
+//  - actual: el que dejó la preparación (la copia recién escrita queda caliente si cabe),
+//  - caliente: antes de preparar se corre la operación una vez sin cronometrar sobre otra
+//    entrada (o sobre la misma si es una referencia que la operación no modifica), así que
+//    el código, los predictores de saltos y las estructuras auxiliares también están listos,
+//  - frio: después de preparar se recorre un búfer del doble de la última caché y se vacían
+//    con clflush las líneas de las entradas contiguas (vectores); datos y TLB quedan fríos,
+//  - frio_tlb: los datos siguen en caché pero se toca la primera línea de cada página de un
+//    búfer de 64 MiB en páginas de 4 KiB, más páginas que entradas tiene la STLB; como todas
+//    las líneas tocadas caen en los mismos conjuntos de L1 y L2, casi no desplazan datos.
+// Caliente y frío acotan la latencia real de un solo ordenamiento o búsqueda. En los modos
+// fríos no hay lotes (cada muestra es una operación) y las celdas en paralelo se enfrían
+// entre sí: conviene --hilos 1.
+
+enum class EstadoCache { Actual, Caliente, Frio, FrioTLB, NumEstados };
+
+inline const char* nombreEstadoCache(EstadoCache estado) {
+    static const char* nombres[] = {"actual", "caliente", "frio", "frio_tlb"};
+    return nombres[static_cast<int>(estado)];
+}
+
+inline bool leerEstadoCache(const std::string& nombre, EstadoCache& estado) {
+    for (int e = 0; e < static_cast<int>(EstadoCache::NumEstados); e++) {
+        if (nombre == nombreEstadoCache(static_cast<EstadoCache>(e))) {
+            estado = static_cast<EstadoCache>(e);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Nivel de caché de datos o unificada de la CPU 0, leído de sysfs
+struct NivelCache {
+    int nivel = 0;
+    std::string tipo; // "Data" o "Unified"
+    long long bytes = 0;
+
+    // "L1d", "L2", "L3"
+    std::string nombre() const { return "L" + std::to_string(nivel) + (tipo == "Data" ? "d" : ""); }
+};
+
+// Niveles de /sys/devices/system/cpu/cpu0/cache, del más chico al más grande (vacío si no hay sysfs)
+inline std::vector<NivelCache> nivelesCache() {
+    std::vector<NivelCache> niveles;
+    for (int indice = 0;; indice++) {
+        std::string base = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(indice) + "/";
+        std::ifstream archivoTipo(base + "type"), archivoTamano(base + "size"), archivoNivel(base + "level");
+        if (!archivoTipo || !archivoTamano) break;
+        NivelCache nivel;
+        std::string texto;
+        archivoTipo >> nivel.tipo;
+        archivoTamano >> texto;
+        archivoNivel >> nivel.nivel;
+        if (nivel.tipo == "Instruction" || texto.empty()) continue;
+        nivel.bytes = std::atoll(texto.c_str());
+        char unidad = texto.back();
+        if (unidad == 'K') nivel.bytes <<= 10;
+        else if (unidad == 'M') nivel.bytes <<= 20;
+        else if (unidad == 'G') nivel.bytes <<= 30;
+        if (nivel.bytes > 0) niveles.push_back(nivel);
+    }
+    std::sort(niveles.begin(), niveles.end(), [](const NivelCache& a, const NivelCache& b) { return a.bytes < b.bytes; });
+    return niveles;
+}
+
+// Tamaños en bytes de las cachés de datos/unificadas de la CPU 0 (L1d, L2, L3), de sysfs
+inline std::vector<long long> tamanosCache() {
+    std::vector<long long> tamanos;
+    for (const NivelCache& nivel : nivelesCache()) tamanos.push_back(nivel.bytes);
+    tamanos.erase(std::unique(tamanos.begin(), tamanos.end()), tamanos.end());
+    return tamanos;
+}
+
+// Búfer que se recorre para expulsar datos o entradas de la TLB. Con mmap y MADV_NOHUGEPAGE
+// para que el kernel no lo respalde con páginas de 2 MiB (que casi no ocupan la TLB)
+class BuferExpulsion {
+public:
+    explicit BuferExpulsion(size_t bytes) : bytes(bytes) {
+#if defined(__unix__)
+        void* memoria = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memoria != MAP_FAILED) {
+#ifdef MADV_NOHUGEPAGE
+            madvise(memoria, bytes, MADV_NOHUGEPAGE);
+#endif
+            datos = static_cast<unsigned char*>(memoria);
+        }
+#endif
+        if (!datos) {
+            datos = static_cast<unsigned char*>(std::malloc(bytes));
+            mapeado = false;
+        }
+        // Valores distintos de cero: las páginas quedan asignadas y no se comparten con la página cero
+        for (size_t i = 0; i < bytes; i += 64) datos[i] = static_cast<unsigned char>(i >> 6) | 1;
+    }
+
+    BuferExpulsion(const BuferExpulsion&) = delete;
+    BuferExpulsion& operator=(const BuferExpulsion&) = delete;
+
+    ~BuferExpulsion() {
+#if defined(__unix__)
+        if (mapeado) {
+            munmap(datos, bytes);
+            return;
+        }
+#endif
+        std::free(datos);
+    }
+
+    // Lee un byte cada "paso" bytes; devuelve la suma para que no se elimine la lectura
+    unsigned recorrer(size_t paso) const {
+        unsigned suma = 0;
+        for (size_t i = 0; i < bytes; i += paso) suma += reinterpret_cast<const volatile unsigned char*>(datos)[i];
+        return suma;
+    }
+
+private:
+    unsigned char* datos = nullptr;
+    size_t bytes;
+    bool mapeado = true;
+};
+
+// Expulsa de todas las cachés (y de la TLB) lo que no sea el propio búfer: lo recorre línea
+// por línea, dos veces el tamaño de la última caché (al menos 64 MiB)
+inline unsigned expulsarCaches() {
+    static const BuferExpulsion bufer([] {
+        std::vector<long long> tamanos = tamanosCache();
+        long long ultima = tamanos.empty() ? 0 : tamanos.back();
+        return static_cast<size_t>(std::max(2 * ultima, 64LL << 20));
+    }());
+    return bufer.recorrer(64);
+}
+
+// Expulsa las traducciones de la TLB sin desplazar casi datos: una línea por página de 4 KiB
+inline unsigned expulsarTLB() {
+    static const BuferExpulsion bufer(64 << 20);
+    return bufer.recorrer(4096);
+}
+
+// Vacía de todas las cachés las líneas de [datos, datos + bytes)
+inline void vaciarLineas(const void* datos, size_t bytes) {
+#if defined(__x86_64__) || defined(__i386__)
+    const char* inicio = static_cast<const char*>(datos);
+    for (size_t i = 0; i < bytes; i += 64) _mm_clflush(inicio + i);
+    if (bytes > 0) _mm_clflush(inicio + bytes - 1);
+    _mm_mfence();
+#else
+    (void)datos;
+    (void)bytes;
+#endif
+}
+
+#endif // ESTADOCACHE_H
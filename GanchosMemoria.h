@@ -0,0 +1,122 @@
+#ifndef GANCHOSMEMORIA_H
+#define GANCHOSMEMORIA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "MedicionMemoria.h"
+#include "PaginasMemoria.h"
+
+// Reemplazos globales de operator new/delete que cuentan reservas y bytes en los contadores
+// del hilo (MedicionMemoria.h). Las funciones de reemplazo no pueden ser inline: este archivo
+// se incluye desde un solo .cpp por ejecutable (cada programa del proyecto tiene uno).
+//
+// Cada bloque lleva delante un prefijo con su tamaño, para descontarlo al liberar aunque el
+// compilador no use la versión de delete con tamaño, y la arena de la que salió (nullptr si
+// salió de malloc): con una arena en uso en el hilo (PaginasMemoria.h) las reservas sin
+// alineación extendida salen de ella.
+
+inline void registrarAsignacion(std::size_t bytes) {
+    ContadoresMemoria& contadores = contadoresMemoriaHilo;
+    contadores.asignaciones++;
+    contadores.bytesAsignados += static_cast<long long>(bytes);
+    contadores.bytesVivos += static_cast<long long>(bytes);
+    if (contadores.bytesVivos > contadores.picoVivos) contadores.picoVivos = contadores.bytesVivos;
+}
+
+inline std::size_t prefijoGancho(std::size_t alineacion) {
+    return alineacion > alignof(std::max_align_t) ? alineacion : alignof(std::max_align_t);
+}
+
+static_assert(alignof(std::max_align_t) >= sizeof(std::size_t) + sizeof(ArenaPaginas*), "El prefijo no cabe");
+
+inline void* reservarContado(std::size_t bytes, std::size_t alineacion) {
+    std::size_t prefijo = prefijoGancho(alineacion);
+    ArenaPaginas* arena = alineacion > alignof(std::max_align_t) ? nullptr : arenaPaginasHilo;
+    void* bloque;
+    if (arena) {
+        bloque = arena->reservar(prefijo + bytes);
+    } else if (alineacion > alignof(std::max_align_t)) {
+        // aligned_alloc pide un tamaño múltiplo de la alineación
+        bloque = std::aligned_alloc(alineacion, (prefijo + bytes + alineacion - 1) / alineacion * alineacion);
+    } else {
+        bloque = std::malloc(prefijo + bytes);
+    }
+    if (!bloque) return nullptr;
+    char* datos = static_cast<char*>(bloque) + prefijo;
+    reinterpret_cast<std::size_t*>(datos)[-1] = bytes;
+    reinterpret_cast<ArenaPaginas**>(datos - sizeof(std::size_t))[-1] = arena;
+    registrarAsignacion(bytes);
+    return datos;
+}
+
+inline void liberarContado(void* puntero, std::size_t alineacion) {
+    if (!puntero) return;
+    char* datos = static_cast<char*>(puntero);
+    std::size_t bytes = reinterpret_cast<std::size_t*>(datos)[-1];
+    ArenaPaginas* arena = reinterpret_cast<ArenaPaginas**>(datos - sizeof(std::size_t))[-1];
+    contadoresMemoriaHilo.bytesVivos -= static_cast<long long>(bytes);
+    std::size_t prefijo = prefijoGancho(alineacion);
+    if (arena) arena->liberar(datos - prefijo, prefijo + bytes);
+    else std::free(datos - prefijo);
+}
+
+// Como el operator new estándar: reintenta con el new_handler instalado o lanza bad_alloc
+inline void* reservarOLanzar(std::size_t bytes, std::size_t alineacion) {
+    if (bytes == 0) bytes = 1;
+    while (true) {
+        if (void* datos = reservarContado(bytes, alineacion)) return datos;
+        std::new_handler manejador = std::get_new_handler();
+        if (!manejador) throw std::bad_alloc();
+        manejador();
+    }
+}
+
+inline const bool ganchosMemoriaRegistrados = (ganchosMemoriaInstalados = true);
+
+void* operator new(std::size_t bytes) { return reservarOLanzar(bytes, 0); }
+void* operator new[](std::size_t bytes) { return reservarOLanzar(bytes, 0); }
+void* operator new(std::size_t bytes, std::align_val_t alineacion) { return reservarOLanzar(bytes, static_cast<std::size_t>(alineacion)); }
+void* operator new[](std::size_t bytes, std::align_val_t alineacion) { return reservarOLanzar(bytes, static_cast<std::size_t>(alineacion)); }
+
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept {
+    try {
+        return reservarOLanzar(bytes, 0);
+    } catch (...) {
+        return nullptr;
+    }
+}
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept { return operator new(bytes, std::nothrow); }
+void* operator new(std::size_t bytes, std::align_val_t alineacion, const std::nothrow_t&) noexcept {
+    try {
+        return reservarOLanzar(bytes, static_cast<std::size_t>(alineacion));
+    } catch (...) {
+        return nullptr;
+    }
+}
+void* operator new[](std::size_t bytes, std::align_val_t alineacion, const std::nothrow_t&) noexcept {
+    return operator new(bytes, alineacion, std::nothrow);
+}
+
+void operator delete(void* puntero) noexcept { liberarContado(puntero, 0); }
+void operator delete[](void* puntero) noexcept { liberarContado(puntero, 0); }
+void operator delete(void* puntero, std::size_t) noexcept { liberarContado(puntero, 0); }
+void operator delete[](void* puntero, std::size_t) noexcept { liberarContado(puntero, 0); }
+void operator delete(void* puntero, const std::nothrow_t&) noexcept { liberarContado(puntero, 0); }
+void operator delete[](void* puntero, const std::nothrow_t&) noexcept { liberarContado(puntero, 0); }
+void operator delete(void* puntero, std::align_val_t alineacion) noexcept { liberarContado(puntero, static_cast<std::size_t>(alineacion)); }
+void operator delete[](void* puntero, std::align_val_t alineacion) noexcept { liberarContado(puntero, static_cast<std::size_t>(alineacion)); }
+void operator delete(void* puntero, std::size_t, std::align_val_t alineacion) noexcept {
+    liberarContado(puntero, static_cast<std::size_t>(alineacion));
+}
+void operator delete[](void* puntero, std::size_t, std::align_val_t alineacion) noexcept {
+    liberarContado(puntero, static_cast<std::size_t>(alineacion));
+}
+void operator delete(void* puntero, std::align_val_t alineacion, const std::nothrow_t&) noexcept {
+    liberarContado(puntero, static_cast<std::size_t>(alineacion));
+}
+void operator delete[](void* puntero, std::align_val_t alineacion, const std::nothrow_t&) noexcept {
+    liberarContado(puntero, static_cast<std::size_t>(alineacion));
+}
+
+#endif // GANCHOSMEMORIA_H
@@ -0,0 +1,241 @@
+#ifndef GENERADORESENTRADA_H
+#define GENERADORESENTRADA_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Trazas.h"
+
+// Generadores de entradas reproducibles: cada distribución depende solo de (n, semilla,
+// parámetros). Los elementos se generan por bloques de tamaño fijo, cada uno con su propio
+// flujo pseudoaleatorio derivado de (semilla, bloque), así que el resultado es el mismo con
+// cualquier número de hilos y las entradas de 10^8 elementos se generan en paralelo. Solo se
+// usan mt19937_64 y aritmética propia (no las distribuciones de <random>, cuyos valores
+// dependen de la biblioteca estándar).
+
+const uint64_t semillaEntradas = 12345; // Semilla por defecto de todos los programas
+
+// Cambiar si cambian los valores que genera alguna distribución por algo que la huella del
+// código de generarEntrada no ve (p. ej. una tabla en datos escribibles); lo usan las cachés
+// de entradas y de resultados
+const uint32_t versionGeneradores = 1;
+
+enum class Distribucion {
+    Ordenada,       // 0, 1, ..., n-1 (mejor caso)
+    Inversa,        // n, n-1, ..., 1 (peor caso)
+    Aleatoria,      // Permutación aleatoria de 0..n-1 (caso promedio)
+    CasiOrdenada,   // Ordenada con k intercambios aleatorios
+    PocosUnicos,    // Valores uniformes entre unos pocos distintos
+    DienteDeSierra, // Varias rampas ascendentes
+    Organo,         // Sube hasta la mitad y baja
+    Zipf,           // Rango k con probabilidad proporcional a 1/k^s
+    TodosIguales,
+    Aleatoria64     // Enteros uniformes de 64 bits (truncados si T es más chico)
+};
+
+const int numDistribuciones = 10;
+
+// Nombres usados en la configuración de barridos y en la salida
+inline const char* nombreDistribucion(Distribucion distribucion) {
+    switch (distribucion) {
+        case Distribucion::Ordenada: return "mejor";
+        case Distribucion::Inversa: return "peor";
+        case Distribucion::Aleatoria: return "promedio";
+        case Distribucion::CasiOrdenada: return "casi_ordenada";
+        case Distribucion::PocosUnicos: return "pocos_unicos";
+        case Distribucion::DienteDeSierra: return "sierra";
+        case Distribucion::Organo: return "organo";
+        case Distribucion::Zipf: return "zipf";
+        case Distribucion::TodosIguales: return "iguales";
+        default: return "aleatoria64";
+    }
+}
+
+inline bool leerDistribucion(const std::string& nombre, Distribucion& distribucion) {
+    for (int d = 0; d < numDistribuciones; d++) {
+        if (nombre == nombreDistribucion(static_cast<Distribucion>(d))) {
+            distribucion = static_cast<Distribucion>(d);
+            return true;
+        }
+    }
+    return false;
+}
+
+struct ParametrosDistribucion {
+    long long intercambios = -1; // CasiOrdenada: -1 = n/100
+    int unicos = 16;             // PocosUnicos
+    int dientes = 8;             // DienteDeSierra: número de rampas
+    double exponenteZipf = 1.0;  // Zipf: s
+    int rangosZipf = 1 << 20;    // Zipf: valores distintos como máximo (también acotado por n)
+};
+
+// Mezclador de splitmix64: convierte enteros consecutivos en valores bien distribuidos
+inline uint64_t mezclar64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Flujo pseudoaleatorio independiente para cada (semilla, índice)
+inline std::mt19937_64 flujoAleatorio(uint64_t semilla, uint64_t indice) {
+    return std::mt19937_64(mezclar64(semilla ^ mezclar64(indice)));
+}
+
+// Uniforme en [0, 1) con 53 bits; a diferencia de std::uniform_real_distribution, da los mismos
+// valores con cualquier biblioteca estándar
+inline double uniforme01(std::mt19937_64& generador) {
+    return (generador() >> 11) * 0x1.0p-53;
+}
+
+const size_t tamanoBloqueGeneracion = 1 << 16;
+
+// Llama funcion(bloque, inicio, fin) para cada bloque de [0, n), repartiendo los bloques entre
+// hilos (0: uno por CPU). Con pocos bloques no se crean hilos.
+template <class Funcion>
+void paraCadaBloque(size_t n, int hilos, Funcion funcion) {
+    size_t bloques = (n + tamanoBloqueGeneracion - 1) / tamanoBloqueGeneracion;
+    if (hilos <= 0) hilos = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    hilos = static_cast<int>(std::min<size_t>(hilos, bloques));
+    auto trabajar = [&](int hilo) {
+        for (size_t b = hilo; b < bloques; b += hilos) {
+            funcion(b, b * tamanoBloqueGeneracion, std::min(n, (b + 1) * tamanoBloqueGeneracion));
+        }
+    };
+    if (hilos <= 1) {
+        for (size_t b = 0; b < bloques; b++) funcion(b, b * tamanoBloqueGeneracion, std::min(n, (b + 1) * tamanoBloqueGeneracion));
+        return;
+    }
+    std::vector<std::thread> trabajadores;
+    for (int h = 0; h < hilos; h++) trabajadores.emplace_back(trabajar, h);
+    for (std::thread& trabajador : trabajadores) trabajador.join();
+}
+
+// Reparte [0, n) en partes casi iguales y llama funcion(parte, inicio, fin) en paralelo
+template <class Funcion>
+void paraCadaParte(size_t partes, size_t n, int hilos, Funcion funcion) {
+    size_t largo = (n + partes - 1) / partes;
+    if (hilos <= 0) hilos = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    hilos = static_cast<int>(std::min<size_t>(hilos, partes));
+    auto trabajar = [&](int hilo) {
+        for (size_t p = hilo; p < partes; p += hilos) funcion(p, std::min(n, p * largo), std::min(n, (p + 1) * largo));
+    };
+    std::vector<std::thread> trabajadores;
+    for (int h = 1; h < hilos; h++) trabajadores.emplace_back(trabajar, h);
+    trabajar(0);
+    for (std::thread& trabajador : trabajadores) trabajador.join();
+}
+
+// Permutación aleatoria uniforme de 0..n-1 en paralelo: cada elemento elige una cubeta al azar
+// (contar y luego dispersar regenerando el mismo flujo), y después cada cubeta, que cabe en
+// caché, se baraja con Fisher-Yates. Las partes, las cubetas y sus flujos no dependen del
+// número de hilos.
+template <class T>
+void generarPermutacion(std::vector<T>& datos, uint64_t semilla, int hilos) {
+    size_t n = datos.size();
+    const size_t elementosPorCubeta = 1 << 16, maximoCubetas = 4096;
+    size_t cubetas = std::clamp<size_t>(n / elementosPorCubeta, 1, maximoCubetas);
+    size_t partes = cubetas;
+    auto cubetaAleatoria = [cubetas](std::mt19937_64& generador) { return static_cast<size_t>(((generador() >> 32) * cubetas) >> 32); };
+
+    // conteos[parte * cubetas + cubeta]
+    std::vector<size_t> conteos(partes * cubetas, 0);
+    paraCadaParte(partes, n, hilos, [&](size_t parte, size_t inicio, size_t fin) {
+        std::mt19937_64 generador = flujoAleatorio(semilla, parte);
+        for (size_t i = inicio; i < fin; i++) conteos[parte * cubetas + cubetaAleatoria(generador)]++;
+    });
+
+    // Posición inicial de cada (parte, cubeta): las cubetas en orden y, dentro de cada una, las partes
+    std::vector<size_t> inicioCubeta(cubetas + 1, 0);
+    size_t posicion = 0;
+    for (size_t c = 0; c < cubetas; c++) {
+        inicioCubeta[c] = posicion;
+        for (size_t p = 0; p < partes; p++) {
+            size_t conteo = conteos[p * cubetas + c];
+            conteos[p * cubetas + c] = posicion;
+            posicion += conteo;
+        }
+    }
+    inicioCubeta[cubetas] = n;
+
+    paraCadaParte(partes, n, hilos, [&](size_t parte, size_t inicio, size_t fin) {
+        std::mt19937_64 generador = flujoAleatorio(semilla, parte);
+        for (size_t i = inicio; i < fin; i++) datos[conteos[parte * cubetas + cubetaAleatoria(generador)]++] = static_cast<T>(i);
+    });
+
+    paraCadaParte(cubetas, cubetas, hilos, [&](size_t, size_t primera, size_t ultima) {
+        for (size_t c = primera; c < ultima; c++) {
+            std::mt19937_64 generador = flujoAleatorio(~semilla, c);
+            for (size_t i = inicioCubeta[c + 1] - inicioCubeta[c]; i > 1; i--) {
+                std::swap(datos[inicioCubeta[c] + i - 1], datos[inicioCubeta[c] + generador() % i]);
+            }
+        }
+    });
+}
+
+// Entrada de n elementos con la distribución dada
+template <class T = int>
+std::vector<T> generarEntrada(Distribucion distribucion, size_t n, uint64_t semilla = semillaEntradas,
+                              const ParametrosDistribucion& parametros = {}, int hilos = 0) {
+    ZONA_TRAZA("generar");
+    std::vector<T> datos(n);
+    if (n == 0) return datos;
+
+    // Tabla acumulada de Zipf para muestrear por búsqueda binaria
+    std::vector<double> acumuladaZipf;
+    if (distribucion == Distribucion::Zipf) {
+        size_t rangos = std::max<size_t>(1, std::min<size_t>(n, parametros.rangosZipf));
+        acumuladaZipf.resize(rangos);
+        double suma = 0;
+        for (size_t k = 0; k < rangos; k++) acumuladaZipf[k] = suma += 1 / std::pow(static_cast<double>(k + 1), parametros.exponenteZipf);
+        for (double& valor : acumuladaZipf) valor /= suma;
+    }
+    size_t largoDiente = (n + std::max(1, parametros.dientes) - 1) / std::max(1, parametros.dientes);
+    uint64_t unicos = static_cast<uint64_t>(std::max(1, parametros.unicos));
+
+    paraCadaBloque(n, hilos, [&](size_t bloque, size_t inicio, size_t fin) {
+        std::mt19937_64 generador = flujoAleatorio(semilla, bloque);
+        for (size_t i = inicio; i < fin; i++) {
+            switch (distribucion) {
+                case Distribucion::Ordenada:
+                case Distribucion::CasiOrdenada: datos[i] = static_cast<T>(i); break;
+                case Distribucion::Inversa: datos[i] = static_cast<T>(n - i); break;
+                case Distribucion::Aleatoria: break; // Se genera aparte
+                case Distribucion::PocosUnicos: datos[i] = static_cast<T>(generador() % unicos); break;
+                case Distribucion::DienteDeSierra: datos[i] = static_cast<T>(i % largoDiente); break;
+                case Distribucion::Organo: datos[i] = static_cast<T>(i < n / 2 ? i : n - 1 - i); break;
+                case Distribucion::Zipf:
+                    datos[i] = static_cast<T>(std::lower_bound(acumuladaZipf.begin(), acumuladaZipf.end() - 1, uniforme01(generador)) - acumuladaZipf.begin());
+                    break;
+                case Distribucion::TodosIguales: datos[i] = static_cast<T>(42); break;
+                case Distribucion::Aleatoria64: datos[i] = static_cast<T>(generador()); break;
+            }
+        }
+    });
+
+    if (distribucion == Distribucion::Aleatoria) generarPermutacion(datos, semilla, hilos);
+
+    // Los intercambios dependen unos de otros: un solo flujo (k es chico frente a n)
+    if (distribucion == Distribucion::CasiOrdenada) {
+        long long intercambios = parametros.intercambios >= 0 ? parametros.intercambios : static_cast<long long>(n / 100);
+        std::mt19937_64 generador = flujoAleatorio(semilla, ~0ULL);
+        for (long long k = 0; k < intercambios; k++) {
+            size_t a = generador() % n, b = generador() % n;
+            std::swap(datos[a], datos[b]);
+        }
+    }
+    return datos;
+}
+
+// Atajos con los nombres de siempre para los tres casos clásicos
+inline std::vector<int> generarMejorCaso(int n) { return generarEntrada(Distribucion::Ordenada, n); }
+inline std::vector<int> generarPeorCaso(int n) { return generarEntrada(Distribucion::Inversa, n); }
+inline std::vector<int> generarCasoPromedio(int n, uint64_t semilla = semillaEntradas) {
+    return generarEntrada(Distribucion::Aleatoria, n, semilla);
+}
+
+#endif // GENERADORESENTRADA_H
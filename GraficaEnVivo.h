@@ -0,0 +1,125 @@
+#ifndef GRAFICAENVIVO_H
+#define GRAFICAENVIVO_H
+
+#include "qcustomplot.h"
+#include <QObject>
+#include <QTimer>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ArnesBenchmark.h"
+#include "ColaSPSC.h"
+
+// Ejecución de los benchmarks en un hilo de trabajo con gráfica en vivo. El hilo de trabajo
+// publica cada celda medida en una ColaSPSC; en el hilo de la interfaz un QTimer vacía la cola,
+// agrega los puntos con QCPGraph::addData y pide un rpQueuedReplot, así la ventana responde y
+// los resultados parciales aparecen en cuanto se miden. Solo el hilo de trabajo toca la
+// memoria de los resultados hasta que termina; entonces alTerminar corre en el hilo de la
+// interfaz y puede leerlos para las gráficas y ajustes finales.
+
+// Serie de la gráfica en vivo (una por caso)
+struct SerieEnVivo {
+    QString nombre;
+    QColor color;
+};
+
+// Publica la celda medida de una serie; devuelve false si la ejecución se canceló
+using PublicarCelda = std::function<bool(int serie, int n, const EstadisticasCelda& celda)>;
+
+class MedicionEnVivo {
+public:
+    MedicionEnVivo(QCustomPlot* grafico, const std::vector<SerieEnVivo>& series, int intervaloMs = 50) : grafico(grafico) {
+        for (const SerieEnVivo& serie : series) {
+            QCPGraph* grafica = grafico->addGraph();
+            grafica->setPen(QPen(serie.color));
+            grafica->setName(serie.nombre);
+            grafica->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 4));
+        }
+        grafico->xAxis->setLabel("Tamaño de entrada (n)");
+        grafico->yAxis->setLabel("Tiempo (nanosegundos, mediana)");
+        grafico->legend->setVisible(true);
+        temporizador.setInterval(intervaloMs);
+        QObject::connect(&temporizador, &QTimer::timeout, [this] { drenar(); });
+    }
+
+    MedicionEnVivo(const MedicionEnVivo&) = delete;
+    MedicionEnVivo& operator=(const MedicionEnVivo&) = delete;
+
+    ~MedicionEnVivo() { detener(); }
+
+    // Cancela y espera al hilo de trabajo. Si se cierra la ventana antes de terminar, el hilo
+    // se detiene al acabar la celda en curso
+    void detener() {
+        cancelado.store(true, std::memory_order_relaxed);
+        if (trabajador.joinable()) trabajador.join();
+    }
+
+    // Lanza medir en el hilo de trabajo; alTerminar corre en el hilo de la interfaz después
+    // de graficar la última celda publicada
+    void iniciar(std::function<void()> medir, std::function<void()> alTerminar) {
+        this->alTerminar = std::move(alTerminar);
+        temporizador.start();
+        trabajador = std::thread([this, medir = std::move(medir)] {
+            medir();
+            terminado.store(true, std::memory_order_release);
+        });
+    }
+
+    // Solo desde el hilo de trabajo. Si la cola está llena espera a que la interfaz la vacíe
+    bool publicar(int serie, int n, const EstadisticasCelda& celda) {
+        PuntoEnVivo punto{serie, n, celda.mediana};
+        while (!cola.intentarEncolar(std::move(punto))) {
+            if (cancelada()) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return !cancelada();
+    }
+
+    PublicarCelda publicador() {
+        return [this](int serie, int n, const EstadisticasCelda& celda) { return publicar(serie, n, celda); };
+    }
+
+    bool cancelada() const { return cancelado.load(std::memory_order_relaxed); }
+
+private:
+    struct PuntoEnVivo {
+        int serie = 0;
+        int n = 0;
+        double mediana = 0;
+    };
+
+    // En el hilo de la interfaz. "terminado" se lee antes de vaciar: si ya estaba puesto, todo
+    // lo publicado es visible y esta pasada lo grafica completo
+    void drenar() {
+        bool finalizado = terminado.load(std::memory_order_acquire);
+        PuntoEnVivo punto;
+        bool nuevos = false;
+        while (cola.intentarDesencolar(punto)) {
+            grafico->graph(punto.serie)->addData(punto.n, punto.mediana);
+            nuevos = true;
+        }
+        if (nuevos) {
+            grafico->rescaleAxes();
+            if (grafico->xAxis->scaleType() == QCPAxis::stLinear) grafico->xAxis->setRangeLower(0);
+            if (grafico->yAxis->scaleType() == QCPAxis::stLinear) grafico->yAxis->setRangeLower(0);
+            grafico->replot(QCustomPlot::rpQueuedReplot);
+        }
+        if (finalizado) {
+            temporizador.stop();
+            if (alTerminar) alTerminar();
+        }
+    }
+
+    QCustomPlot* grafico;
+    QTimer temporizador;
+    ColaSPSC<PuntoEnVivo> cola;
+    std::function<void()> alTerminar;
+    std::atomic<bool> terminado{false};
+    std::atomic<bool> cancelado{false};
+    std::thread trabajador;
+};
+
+#endif // GRAFICAENVIVO_H
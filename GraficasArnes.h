@@ -0,0 +1,207 @@
+#ifndef GRAFICASARNES_H
+#define GRAFICASARNES_H
+
+#include "qcustomplot.h"
+#include <algorithm>
+#include <vector>
+#include "AjusteComplejidad.h"
+#include "ArnesBenchmark.h"
+#include "ConfiguracionBarrido.h"
+#include "PoliticaConteo.h"
+
+// Agrega barras de error del percentil 5 al 95 alrededor de cada punto de la serie
+inline QCPErrorBars* agregarDispersion(QCustomPlot* grafico, QCPGraph* serie, const std::vector<EstadisticasCelda>& celdas) {
+    QVector<double> haciaAbajo, haciaArriba;
+    for (const EstadisticasCelda& celda : celdas) {
+        haciaAbajo.push_back(celda.mediana - celda.p05);
+        haciaArriba.push_back(celda.p95 - celda.mediana);
+    }
+
+    QCPErrorBars* barras = new QCPErrorBars(grafico->xAxis, grafico->yAxis);
+    barras->removeFromLegend();
+    barras->setDataPlottable(serie);
+    barras->setData(haciaAbajo, haciaArriba);
+    barras->setPen(serie->pen());
+    return barras;
+}
+
+// Mayor percentil 95 de las celdas, para que el eje Y incluya las barras de error
+inline double maximoConDispersion(const std::vector<EstadisticasCelda>& celdas) {
+    double maximo = 0;
+    for (const EstadisticasCelda& celda : celdas) {
+        maximo = std::max(maximo, celda.p95);
+    }
+    return maximo;
+}
+
+// Superpone la curva del mejor modelo ajustado (línea punteada del color de la serie), evaluada
+// en una malla fina entre el menor y el mayor tamaño medido
+inline QCPGraph* agregarAjuste(QCustomPlot* grafico, QCPGraph* serie, const QString& caso, const std::vector<int>& tamanos, const ResultadoAjuste& resultado) {
+    if (!resultado.mejor.valido || tamanos.empty()) return nullptr;
+    const int puntos = 100;
+    double inicio = tamanos.front(), fin = tamanos.back();
+    QVector<double> x, y;
+    for (int i = 0; i < puntos; i++) {
+        double n = inicio + (fin - inicio) * i / (puntos - 1);
+        x.push_back(n);
+        y.push_back(resultado.mejor.evaluar(n));
+    }
+
+    QCPGraph* curva = grafico->addGraph();
+    curva->setData(x, y);
+    QPen pluma = serie->pen();
+    pluma.setStyle(Qt::DotLine);
+    curva->setPen(pluma);
+    curva->setName(caso + " ajuste O(" + nombreModelo(resultado.mejor.modelo) + "): " + QString::fromStdString(describirAjuste(resultado.mejor)) +
+                   ", R² = " + QString::number(resultado.mejor.r2, 'f', 4));
+    return curva;
+}
+
+// Métricas derivadas de los contadores de hardware contra n: fallos por elemento en el eje Y
+// izquierdo e IPC en el derecho. Devuelve false si no hubo contadores que graficar.
+inline bool graficarContadores(QCustomPlot* grafico, const std::vector<int>& tamanos, const std::vector<EstadisticasCelda>& celdas) {
+    const QColor colores[NumEventosContador] = {Qt::black, Qt::black, Qt::blue, Qt::red, Qt::darkGreen, Qt::magenta};
+    bool hayDatos = false;
+
+    for (int e = EventoFallosL1; e < NumEventosContador; e++) {
+        QVector<double> x, y;
+        for (size_t i = 0; i < tamanos.size() && i < celdas.size(); ++i) {
+            if (!celdas[i].contadores.disponible(e)) continue;
+            x.push_back(tamanos[i]);
+            y.push_back(celdas[i].contadores.porElemento(e, tamanos[i]));
+        }
+        if (x.isEmpty()) continue;
+        QCPGraph* serie = grafico->addGraph();
+        serie->setData(x, y);
+        serie->setPen(QPen(colores[e]));
+        serie->setName(QString(nombreEvento(e)) + " por elemento");
+        hayDatos = true;
+    }
+
+    QVector<double> x, ipc;
+    for (size_t i = 0; i < tamanos.size() && i < celdas.size(); ++i) {
+        if (celdas[i].contadores.ipc() < 0) continue;
+        x.push_back(tamanos[i]);
+        ipc.push_back(celdas[i].contadores.ipc());
+    }
+    if (!x.isEmpty()) {
+        QCPGraph* serie = grafico->addGraph(grafico->xAxis, grafico->yAxis2);
+        serie->setData(x, ipc);
+        serie->setPen(QPen(Qt::black, 2, Qt::DashLine));
+        serie->setName("IPC");
+        grafico->yAxis2->setVisible(true);
+        grafico->yAxis2->setLabel("Instrucciones por ciclo");
+        hayDatos = true;
+    }
+
+    grafico->xAxis->setLabel("Tamaño de entrada (n)");
+    grafico->yAxis->setLabel("Eventos por elemento");
+    grafico->rescaleAxes();
+    grafico->legend->setVisible(true);
+    grafico->replot();
+    return hayDatos;
+}
+
+// Líneas verticales en el tamaño de cada nivel de caché, con su nombre arriba; el eje X debe
+// estar en bytes
+inline void marcarCaches(QCustomPlot* grafico, const std::vector<NivelCache>& niveles) {
+    for (const NivelCache& nivel : niveles) {
+        QCPItemStraightLine* linea = new QCPItemStraightLine(grafico);
+        linea->point1->setCoords(nivel.bytes, 0);
+        linea->point2->setCoords(nivel.bytes, 1);
+        linea->setPen(QPen(Qt::gray, 1, Qt::DashLine));
+
+        QCPItemText* etiqueta = new QCPItemText(grafico);
+        etiqueta->position->setTypeX(QCPItemPosition::ptPlotCoords);
+        etiqueta->position->setTypeY(QCPItemPosition::ptAxisRectRatio);
+        etiqueta->position->setCoords(nivel.bytes, 0.02);
+        etiqueta->setPositionAlignment(Qt::AlignLeft | Qt::AlignTop);
+        double kib = nivel.bytes / 1024.0;
+        etiqueta->setText(QString::fromStdString(nivel.nombre()) + " " +
+                          (kib >= 1024 ? QString::number(kib / 1024, 'g', 4) + " MiB" : QString::number(kib, 'g', 4) + " KiB"));
+        etiqueta->setColor(Qt::gray);
+    }
+}
+
+// Celdas medidas de un caso (mejor, peor, promedio), una por tamaño de entrada
+struct SerieCeldas {
+    QString nombre;
+    QColor color;
+    std::vector<EstadisticasCelda> celdas;
+};
+
+// Memoria por elemento contra n: un color por caso y un estilo de línea por métrica. Bytes
+// reservados, pico de bytes vivos y pico de RSS en el eje Y izquierdo; reservas y fallos de
+// página por elemento en el derecho. Devuelve false si no se midió memoria.
+inline bool graficarMemoria(QCustomPlot* grafico, const std::vector<int>& tamanos, const std::vector<SerieCeldas>& series) {
+    const Qt::PenStyle estilos[NumMetricasMemoria] = {Qt::DashDotLine, Qt::SolidLine, Qt::DashLine, Qt::DotLine, Qt::DashDotDotLine};
+    bool hayDatos = false, hayConteos = false;
+
+    for (const SerieCeldas& serie : series) {
+        for (int m = 0; m < NumMetricasMemoria; m++) {
+            QVector<double> x, y;
+            for (size_t i = 0; i < tamanos.size() && i < serie.celdas.size(); ++i) {
+                if (!serie.celdas[i].memoria.disponible(m)) continue;
+                x.push_back(tamanos[i]);
+                y.push_back(serie.celdas[i].memoria.porElemento(m, tamanos[i]));
+            }
+            if (x.isEmpty()) continue;
+            bool esConteo = m == MemoriaAsignaciones || m == MemoriaFallosPagina;
+            QCPGraph* grafica = grafico->addGraph(grafico->xAxis, esConteo ? grafico->yAxis2 : grafico->yAxis);
+            grafica->setData(x, y);
+            grafica->setPen(QPen(serie.color, 2, estilos[m]));
+            grafica->setName(serie.nombre + ": " + nombreMetricaMemoria(m) + " por elemento");
+            hayDatos = true;
+            hayConteos = hayConteos || esConteo;
+        }
+    }
+
+    if (hayConteos) {
+        grafico->yAxis2->setVisible(true);
+        grafico->yAxis2->setLabel("Reservas y fallos de página por elemento");
+    }
+    grafico->xAxis->setLabel("Tamaño de entrada (n)");
+    grafico->yAxis->setLabel("Bytes por elemento");
+    grafico->rescaleAxes();
+    grafico->legend->setVisible(true);
+    grafico->replot();
+    return hayDatos;
+}
+
+// Serie de conteos exactos de un caso (mejor, peor, promedio), uno por tamaño de entrada
+struct SerieOperaciones {
+    QString nombre;
+    QColor color;
+    std::vector<Operaciones> conteos;
+};
+
+// Operaciones contadas contra n: un color por caso y un estilo de línea por métrica.
+// Las métricas que quedaron en cero para todos los tamaños de un caso no se grafican.
+inline void graficarOperaciones(QCustomPlot* grafico, const std::vector<int>& tamanos, const std::vector<SerieOperaciones>& series) {
+    const Qt::PenStyle estilos[Operaciones::numMetricas] = {Qt::SolidLine, Qt::DashLine, Qt::DotLine, Qt::DashDotLine, Qt::DashDotDotLine};
+
+    for (const SerieOperaciones& serie : series) {
+        for (int m = 0; m < Operaciones::numMetricas; m++) {
+            QVector<double> x, y;
+            bool hayConteos = false;
+            for (size_t i = 0; i < tamanos.size() && i < serie.conteos.size(); ++i) {
+                x.push_back(tamanos[i]);
+                y.push_back(static_cast<double>(serie.conteos[i].metrica(m)));
+                hayConteos = hayConteos || serie.conteos[i].metrica(m) != 0;
+            }
+            if (!hayConteos) continue;
+            QCPGraph* grafica = grafico->addGraph();
+            grafica->setData(x, y);
+            grafica->setPen(QPen(serie.color, 2, estilos[m]));
+            grafica->setName(serie.nombre + ": " + Operaciones::nombreMetrica(m));
+        }
+    }
+
+    grafico->xAxis->setLabel("Tamaño de entrada (n)");
+    grafico->yAxis->setLabel("Operaciones (conteo exacto)");
+    grafico->rescaleAxes();
+    grafico->legend->setVisible(true);
+    grafico->replot();
+}
+
+#endif // GRAFICASARNES_H
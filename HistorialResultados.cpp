@@ -0,0 +1,132 @@
+#include "qcustomplot.h"
+#include <QApplication>
+#include <QVector>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include "AlmacenResultados.h" // Historial de versiones y prueba de Mann-Whitney
+#include "GraficasArnes.h"     // Barras de dispersión
+
+using namespace std;
+
+// Historia de las celdas del almacén a lo largo de las versiones (commits): la mediana de
+// cada versión con barras p05-p95, y en rojo las versiones que son una regresión respecto a
+// la anterior medida en la misma CPU.
+// Uso: HistorialResultados almacen [--algoritmo A] [--caso C] [--n N]
+// Sin --n se grafica el mayor tamaño medido de cada (algoritmo, caso).
+
+struct FiltroHistorial {
+    string algoritmo, caso;
+    int n = 0; // 0: el mayor tamaño de cada serie
+};
+
+void graficarHistorial(QCustomPlot* grafico, const vector<RegistroAlmacen>& registros, const FiltroHistorial& filtro) {
+    vector<EntornoMedicion> versiones = versionesAlmacen(registros);
+    vector<map<ClaveCelda, vector<double>>> muestrasPorVersion;
+    for (const EntornoMedicion& version : versiones) muestrasPorVersion.push_back(muestrasDeVersion(registros, version));
+
+    // Celdas que pasan el filtro; sin --n, solo el mayor tamaño de cada (algoritmo, caso)
+    map<pair<string, string>, int> mayorTamano;
+    for (const RegistroAlmacen& registro : registros) {
+        if (!filtro.algoritmo.empty() && registro.algoritmo != filtro.algoritmo) continue;
+        if (!filtro.caso.empty() && registro.caso != filtro.caso) continue;
+        if (filtro.n > 0 && registro.n != filtro.n) continue;
+        int& mayor = mayorTamano[{registro.algoritmo, registro.caso}];
+        mayor = max(mayor, registro.n);
+    }
+
+    const QColor colores[] = {Qt::blue, Qt::darkGreen, Qt::magenta, Qt::darkYellow, Qt::darkCyan, Qt::black, Qt::darkRed, Qt::gray};
+    int indiceColor = 0;
+    QVector<double> xRegresiones, yRegresiones, xInsuficientes, yInsuficientes;
+    for (const auto& [serie, n] : mayorTamano) {
+        ClaveCelda clave{serie.first, serie.second, n};
+        QVector<double> x;
+        vector<EstadisticasCelda> celdas;
+        for (size_t v = 0; v < versiones.size(); v++) {
+            auto encontrada = muestrasPorVersion[v].find(clave);
+            if (encontrada == muestrasPorVersion[v].end()) continue;
+            x.push_back(v);
+            celdas.push_back(resumirMuestras(encontrada->second));
+            // Regresión respecto a la última versión anterior de la misma CPU que midió esta celda
+            int anterior = static_cast<int>(v) - 1;
+            while (anterior >= 0 && (versiones[anterior].cpu != versiones[v].cpu || !muestrasPorVersion[anterior].count(clave))) anterior--;
+            if (anterior < 0) continue;
+            ComparacionCelda comparacion = compararMuestras(muestrasPorVersion[anterior][clave], encontrada->second);
+            if (comparacion.regresion) {
+                xRegresiones.push_back(v);
+                yRegresiones.push_back(celdas.back().mediana);
+            } else if (comparacion.insuficiente && comparacion.cambioRelativo >= 0.05) {
+                xInsuficientes.push_back(v);
+                yInsuficientes.push_back(celdas.back().mediana);
+            }
+        }
+        if (x.isEmpty()) continue;
+
+        QVector<double> y;
+        for (const EstadisticasCelda& celda : celdas) y.push_back(celda.mediana);
+        QCPGraph* grafica = grafico->addGraph();
+        grafica->setData(x, y);
+        grafica->setPen(QPen(colores[indiceColor++ % 8]));
+        grafica->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 5));
+        grafica->setName(QString::fromStdString(serie.first + " " + serie.second + " n=" + to_string(n)));
+        agregarDispersion(grafico, grafica, celdas);
+    }
+
+    QCPGraph* regresiones = grafico->addGraph();
+    regresiones->setData(xRegresiones, yRegresiones);
+    regresiones->setLineStyle(QCPGraph::lsNone);
+    regresiones->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 9));
+    regresiones->setPen(QPen(Qt::red));
+    regresiones->setName("Regresión respecto a la versión anterior (Mann-Whitney p < 0.01, +5%)");
+    // +5% sin muestras suficientes para que la prueba llegue a p < 0.01
+    QCPGraph* insuficientes = grafico->addGraph();
+    insuficientes->setData(xInsuficientes, yInsuficientes);
+    insuficientes->setLineStyle(QCPGraph::lsNone);
+    insuficientes->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 9));
+    insuficientes->setPen(QPen(Qt::red));
+    insuficientes->setName("+5% con insuficientes muestras para la prueba");
+
+    // Una marca por versión con su commit
+    QSharedPointer<QCPAxisTickerText> marcas(new QCPAxisTickerText);
+    for (size_t v = 0; v < versiones.size(); v++) marcas->addTick(v, QString::fromStdString(versiones[v].commit));
+    grafico->xAxis->setTicker(marcas);
+    grafico->xAxis->setLabel("Versión (commit)");
+    grafico->xAxis->setRange(-0.5, versiones.size() - 0.5);
+    // Las series tienen escalas muy distintas
+    grafico->yAxis->setScaleType(QCPAxis::stLogarithmic);
+    grafico->yAxis->setTicker(QSharedPointer<QCPAxisTickerLog>(new QCPAxisTickerLog));
+    grafico->yAxis->setLabel("Tiempo (ns, mediana)");
+    grafico->yAxis->rescale();
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        cerr << "Uso: HistorialResultados almacen [--algoritmo A] [--caso C] [--n N]" << endl;
+        return 1;
+    }
+    FiltroHistorial filtro;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        string argumento = argv[i];
+        if (argumento == "--algoritmo") filtro.algoritmo = argv[i + 1];
+        else if (argumento == "--caso") filtro.caso = argv[i + 1];
+        else if (argumento == "--n") filtro.n = atoi(argv[i + 1]);
+    }
+
+    vector<RegistroAlmacen> registros = leerAlmacen(argv[1]);
+    if (registros.empty()) {
+        cerr << argv[1] << ": el almacén está vacío o no existe" << endl;
+        return 1;
+    }
+
+    QApplication app(argc, argv);
+
+    QCustomPlot grafico;
+    grafico.legend->setVisible(true);
+    graficarHistorial(&grafico, registros, filtro);
+    grafico.setWindowTitle("Historial de rendimiento por versión");
+    grafico.resize(1000, 600);
+    grafico.show();
+
+    return app.exec();
+}
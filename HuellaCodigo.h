@@ -0,0 +1,183 @@
+#ifndef HUELLACODIGO_H
+#define HUELLACODIGO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+#include "GeneradoresEntrada.h" // mezclar64
+
+#if defined(__linux__)
+#include <elf.h>
+#include <link.h>
+#endif
+
+// Huella del código máquina de una función del ejecutable y de las que llama directamente,
+// para saber si un algoritmo cambió entre dos compilaciones. Los inicios y tamaños de las
+// funciones salen de la tabla de símbolos (.symtab) de /proc/self/exe; los bytes se leen de
+// la memoria del proceso. En x86-64 los desplazamientos, que cambian cuando se mueve código
+// que no tiene nada que ver, no entran en la huella: cada call/jmp rel32 al inicio de otra
+// función aporta la huella de esa función, y uno a otra parte del código (la PLT), una marca;
+// cada operando relativo a RIP que apunta a datos de solo lectura aporta los bytes apuntados
+// (la cadena o la constante), y uno a datos escribibles (variables, GOT), una marca. Los
+// operandos se reconocen por patrón (opcode común + ModRM de RIP) sin decodificar: un
+// falso positivo es determinista y a lo sumo hace medir de más. Sin tabla de símbolos
+// (ejecutable "strip") la huella es la del archivo completo: cualquier recompilación que
+// cambie el binario invalida todo.
+
+// FNV-1a de 64 bits
+inline uint64_t huellaBytes(const void* datos, size_t n, uint64_t huella = 0xcbf29ce484222325ULL) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(datos);
+    for (size_t i = 0; i < n; i++) huella = (huella ^ bytes[i]) * 0x100000001b3ULL;
+    return huella;
+}
+
+struct SeccionCargada {
+    uintptr_t inicio, fin; // En memoria, [inicio, fin)
+    bool ejecutable, escribible, cadenas;
+};
+
+struct TablaFunciones {
+    std::vector<std::pair<uintptr_t, size_t>> funciones; // Inicio en memoria y tamaño, ordenadas
+    std::vector<SeccionCargada> secciones;
+    uint64_t huellaArchivo = 0;
+
+    const SeccionCargada* seccionDe(uintptr_t direccion) const {
+        for (const SeccionCargada& seccion : secciones) {
+            if (direccion >= seccion.inicio && direccion < seccion.fin) return &seccion;
+        }
+        return nullptr;
+    }
+};
+
+inline const TablaFunciones& tablaFunciones() {
+    static const TablaFunciones tabla = [] {
+        TablaFunciones tabla;
+        std::ifstream archivo("/proc/self/exe", std::ios::binary);
+        std::vector<char> contenido((std::istreambuf_iterator<char>(archivo)), std::istreambuf_iterator<char>());
+        tabla.huellaArchivo = huellaBytes(contenido.data(), contenido.size());
+#if defined(__linux__) && defined(__x86_64__)
+        // Desplazamiento de carga del ejecutable principal (distinto de 0 si es PIE)
+        uintptr_t desplazamiento = 0;
+        dl_iterate_phdr([](dl_phdr_info* informacion, size_t, void* resultado) {
+            *static_cast<uintptr_t*>(resultado) = informacion->dlpi_addr;
+            return 1; // El primero es el ejecutable
+        }, &desplazamiento);
+
+        if (contenido.size() < sizeof(Elf64_Ehdr) || std::memcmp(contenido.data(), ELFMAG, SELFMAG) != 0) return tabla;
+        const Elf64_Ehdr* encabezado = reinterpret_cast<const Elf64_Ehdr*>(contenido.data());
+        if (encabezado->e_shoff + encabezado->e_shnum * sizeof(Elf64_Shdr) > contenido.size()) return tabla;
+        const Elf64_Shdr* secciones = reinterpret_cast<const Elf64_Shdr*>(contenido.data() + encabezado->e_shoff);
+        for (int s = 0; s < encabezado->e_shnum; s++) {
+            if (secciones[s].sh_flags & SHF_ALLOC) {
+                uintptr_t inicio = secciones[s].sh_addr + desplazamiento;
+                tabla.secciones.push_back({inicio, inicio + secciones[s].sh_size, (secciones[s].sh_flags & SHF_EXECINSTR) != 0,
+                                           (secciones[s].sh_flags & SHF_WRITE) != 0, (secciones[s].sh_flags & SHF_STRINGS) != 0});
+            }
+            if (secciones[s].sh_type != SHT_SYMTAB || secciones[s].sh_offset + secciones[s].sh_size > contenido.size()) continue;
+            const Elf64_Sym* simbolos = reinterpret_cast<const Elf64_Sym*>(contenido.data() + secciones[s].sh_offset);
+            for (size_t i = 0; i < secciones[s].sh_size / sizeof(Elf64_Sym); i++) {
+                if (ELF64_ST_TYPE(simbolos[i].st_info) != STT_FUNC || simbolos[i].st_size == 0 || simbolos[i].st_shndx == SHN_UNDEF) continue;
+                tabla.funciones.emplace_back(simbolos[i].st_value + desplazamiento, simbolos[i].st_size);
+            }
+        }
+        std::sort(tabla.funciones.begin(), tabla.funciones.end());
+        tabla.funciones.erase(std::unique(tabla.funciones.begin(), tabla.funciones.end(),
+                                          [](const auto& a, const auto& b) { return a.first == b.first; }),
+                              tabla.funciones.end());
+#endif
+        return tabla;
+    }();
+    return tabla;
+}
+
+// Índice de la función que empieza exactamente en direccion, o -1
+inline long indiceFuncion(const TablaFunciones& tabla, uintptr_t direccion) {
+    auto posicion = std::lower_bound(tabla.funciones.begin(), tabla.funciones.end(), std::make_pair(direccion, size_t(0)));
+    if (posicion == tabla.funciones.end() || posicion->first != direccion) return -1;
+    return static_cast<long>(posicion - tabla.funciones.begin());
+}
+
+// Opcodes (último byte) que suelen llevar un operando de memoria relativo a RIP: lea, mov,
+// aritmética y comparación, movimientos SSE y call/jmp indirectos
+inline bool opcodeConMemoria(unsigned char opcode) {
+    switch (opcode) {
+    case 0x8D: case 0x8B: case 0x89: case 0x88: case 0x8A: case 0x03: case 0x01: case 0x2B: case 0x29: case 0x3B:
+    case 0x39: case 0x33: case 0x31: case 0x23: case 0x21: case 0x0B: case 0x09: case 0x85: case 0xC7: case 0xFF:
+    case 0x10: case 0x11: case 0x28: case 0x6F: case 0x7F: case 0x6E: case 0x7E: case 0x54: case 0x58: case 0x59:
+    case 0x5C: case 0x5E: case 0x2E: case 0x2F: case 0xDB: case 0xEF:
+        return true;
+    default:
+        return false;
+    }
+}
+
+inline uint64_t huellaCodigo(const void* funcion) {
+    const TablaFunciones& tabla = tablaFunciones();
+    long raiz = indiceFuncion(tabla, reinterpret_cast<uintptr_t>(funcion));
+    if (raiz < 0) return tabla.huellaArchivo;
+
+    // Una función ya visitada (recursión, o llamada desde dos lugares) aporta su orden de visita
+    std::map<long, uint64_t> visitadas;
+    std::function<uint64_t(long)> recorrer = [&](long indice) -> uint64_t {
+        auto [visitada, nueva] = visitadas.emplace(indice, visitadas.size());
+        if (!nueva) return mezclar64(visitada->second);
+        auto [inicio, tamano] = tabla.funciones[indice];
+        const unsigned char* codigo = reinterpret_cast<const unsigned char*>(inicio);
+        uint64_t huella = huellaBytes(&tamano, sizeof(tamano));
+        for (size_t i = 0; i < tamano; i++) {
+            if ((codigo[i] == 0xE8 || codigo[i] == 0xE9) && i + 5 <= tamano) {
+                int32_t relativo;
+                std::memcpy(&relativo, codigo + i + 1, sizeof(relativo));
+                uintptr_t destino = inicio + i + 5 + static_cast<intptr_t>(relativo);
+                long llamada = indiceFuncion(tabla, destino);
+                if (llamada >= 0) {
+                    huella = mezclar64(huella ^ codigo[i] ^ recorrer(llamada));
+                    i += 4;
+                    continue;
+                }
+                const SeccionCargada* seccion = tabla.seccionDe(destino);
+                if (seccion && seccion->ejecutable) {
+                    huella = mezclar64(huella ^ codigo[i] ^ 0x504c54); // "PLT"
+                    i += 4;
+                    continue;
+                }
+            }
+            if (opcodeConMemoria(codigo[i]) && i + 6 <= tamano && (codigo[i + 1] & 0xC7) == 0x05) {
+                int32_t relativo;
+                std::memcpy(&relativo, codigo + i + 2, sizeof(relativo));
+                uintptr_t destino = inicio + i + 6 + static_cast<intptr_t>(relativo);
+                const SeccionCargada* seccion = tabla.seccionDe(destino);
+                if (seccion && !seccion->ejecutable) {
+                    huella = mezclar64(huella ^ codigo[i] ^ codigo[i + 1] ^ 0x524950); // "RIP"
+                    if (!seccion->escribible) {
+                        // Constantes: 8 bytes (o un inmediato que siga al desplazamiento corre el
+                        // destino unos bytes, igual de determinista); cadenas: hasta el cero
+                        const unsigned char* datos = reinterpret_cast<const unsigned char*>(destino);
+                        size_t largo = std::min<uintptr_t>(seccion->cadenas ? 256 : 8, seccion->fin - destino);
+                        if (seccion->cadenas) largo = std::find(datos, datos + largo, 0) - datos;
+                        huella = huellaBytes(datos, largo, huella);
+                    }
+                    i += 5;
+                    continue;
+                }
+            }
+            huella = (huella ^ codigo[i]) * 0x100000001b3ULL;
+        }
+        return huella;
+    };
+    return recorrer(raiz);
+}
+
+// Para pasar punteros a función como dirección de código
+template <class Funcion>
+const void* direccionCodigo(Funcion* funcion) {
+    return reinterpret_cast<const void*>(funcion);
+}
+
+#endif // HUELLACODIGO_H
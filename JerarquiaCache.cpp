@@ -0,0 +1,162 @@
+#include "qcustomplot.h"
+#include <QApplication>
+#include <QVector>
+#include <iostream>
+#include <functional>
+#include <string>
+#include <vector>
+#include <list>
+#include <cmath>
+#include <algorithm>
+#include "CargasCache.h"          // Merge Sort, inserción en BST y lista dispersa
+#include "GraficasArnes.h"        // Arnés, barras de dispersión y marcas de caché
+#include "ConfiguracionBarrido.h" // Escaleras de tamaños, niveles de caché y opciones del arnés
+#include "GanchosMemoria.h"       // Reservas de las cargas en la arena de páginas (--paginas)
+
+using namespace std;
+
+// Barrido de la jerarquía de cachés: cada carga se mide en una escalera geométrica de
+// conjuntos de trabajo (bytes que toca la región medida), densificada alrededor de L1, L2 y
+// L3, y se grafica el tiempo por operación contra los bytes, con una línea vertical en cada
+// tamaño de caché (de sysfs). Dentro de un nivel las curvas son planas; los saltos muestran
+// dónde los datos dejan de caber. Al final se imprime el mayor fragmento (en elementos) de
+// cada carga que cabe en cada nivel, para dimensionar particiones que queden en caché.
+// Uso: JerarquiaCache [--hasta BYTES] [--puntos P] [--cargas mezcla,bst,lista] [--clave valor]
+// (las demás claves son las del arnés en ConfiguracionBarrido.h: repeticiones_max, presupuesto_ms,
+// paginas, ...)
+
+// Punto medido de una carga: conjunto de trabajo, n y la celda con los tiempos por operación
+struct PuntoCache {
+    double bytes;
+    int n;
+    EstadisticasCelda celda;
+};
+
+vector<PuntoCache> barrerCarga(const CargaCache& carga, const vector<int>& bytesEscalera, const ConfiguracionArnes& arnes) {
+    vector<PuntoCache> puntos;
+    vector<double> tamanosMedidos, medianas;
+    int anterior = 0;
+    for (int bytes : bytesEscalera) {
+        int n = static_cast<int>(bytes / carga.bytesPorElemento);
+        if (n < 16 || n == anterior) continue;
+        anterior = n;
+
+        double prediccionNs;
+        if (excederiaPresupuesto(tamanosMedidos, medianas, n, arnes, prediccionNs)) {
+            cout << carga.nombre << ": se omiten los conjuntos desde " << bytes << " bytes (se predicen " << prediccionNs
+                 << " ns por repetición, excede el presupuesto)" << endl;
+            break;
+        }
+        EstadisticasCelda celda = carga.medir(n, arnes);
+        tamanosMedidos.push_back(n);
+        medianas.push_back(celda.mediana);
+
+        // Tiempos por operación: las barras de dispersión quedan en la misma escala
+        double operaciones = carga.operaciones(n);
+        celda.mediana /= operaciones;
+        celda.p05 /= operaciones;
+        celda.p95 /= operaciones;
+        cout << carga.nombre << "\tbytes=" << static_cast<long long>(n) * carga.bytesPorElemento << "\tn=" << n
+             << "\tns/" << carga.operacion << "=" << celda.mediana << endl;
+        puntos.push_back({static_cast<double>(n) * carga.bytesPorElemento, n, move(celda)});
+    }
+    return puntos;
+}
+
+void graficarJerarquia(QCustomPlot* grafico, const vector<CargaCache>& cargas, const vector<vector<PuntoCache>>& puntos, const vector<NivelCache>& niveles) {
+    const QColor colores[] = {Qt::blue, Qt::red, Qt::darkGreen, Qt::magenta, Qt::darkCyan};
+    for (size_t c = 0; c < cargas.size(); c++) {
+        QVector<double> x, y;
+        vector<EstadisticasCelda> celdas;
+        for (const PuntoCache& punto : puntos[c]) {
+            x.push_back(punto.bytes);
+            y.push_back(punto.celda.mediana);
+            celdas.push_back(punto.celda);
+        }
+        QCPGraph* grafica = grafico->addGraph();
+        grafica->setData(x, y);
+        grafica->setPen(QPen(colores[c % 5], 2));
+        grafica->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 4));
+        grafica->setName(QString::fromStdString(cargas[c].nombre + " (ns por " + cargas[c].operacion + ")"));
+        agregarDispersion(grafico, grafica, celdas);
+    }
+
+    grafico->xAxis->setScaleType(QCPAxis::stLogarithmic);
+    grafico->xAxis->setTicker(QSharedPointer<QCPAxisTickerLog>(new QCPAxisTickerLog));
+    grafico->xAxis->setLabel("Conjunto de trabajo (bytes)");
+    grafico->yAxis->setLabel("Tiempo por operación (ns, mediana)");
+    grafico->rescaleAxes();
+    grafico->yAxis->setRangeLower(0);
+    marcarCaches(grafico, niveles);
+    grafico->legend->setVisible(true);
+    grafico->replot();
+}
+
+// Mayor fragmento de cada carga que cabe en cada nivel de caché
+void imprimirFragmentos(const vector<CargaCache>& cargas, const vector<NivelCache>& niveles) {
+    cout << endl << "Mayor fragmento que cabe en cada nivel (elementos):" << endl << "carga";
+    for (const NivelCache& nivel : niveles) cout << "\t" << nivel.nombre() << " (" << nivel.bytes / 1024 << " KiB)";
+    cout << endl;
+    for (const CargaCache& carga : cargas) {
+        cout << carga.nombre;
+        for (const NivelCache& nivel : niveles) cout << "\t" << nivel.bytes / static_cast<long long>(carga.bytesPorElemento);
+        cout << endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    vector<NivelCache> niveles = nivelesCache();
+    if (niveles.empty()) cerr << "No se encontraron los tamaños de caché en sysfs; no se marcarán en la gráfica" << endl;
+
+    // Por defecto hasta 4 veces la última caché (entre 64 MiB y 1 GiB), para ver la meseta de DRAM
+    double hasta = niveles.empty() ? 256.0 * (1 << 20) : clamp(4.0 * niveles.back().bytes, 64.0 * (1 << 20), 1024.0 * (1 << 20));
+    double puntos = 30;
+    vector<string> nombresCargas;
+    ConfiguracionBarrido barrido;
+    barrido.arnes.repeticionesMinimas = 3;
+    barrido.arnes.repeticionesMaximas = 15;
+    barrido.arnes.presupuestoNs = 10000000000LL;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string clave = argv[i], valor = argv[i + 1];
+        if (clave.rfind("--", 0) != 0) continue; // Argumentos de Qt
+        clave = clave.substr(2);
+        replace(clave.begin(), clave.end(), '-', '_');
+        bool valido;
+        if (clave == "hasta") valido = leerNumero(valor, hasta) && hasta >= 4096 && hasta <= 1024.0 * (1 << 20);
+        else if (clave == "puntos") valido = leerNumero(valor, puntos) && puntos >= 2;
+        else if (clave == "cargas") valido = !(nombresCargas = separarLista(valor)).empty();
+        else valido = aplicarOpcionBarrido(barrido, clave, valor);
+        if (!valido) {
+            cerr << "Opción no válida: --" << clave << " " << valor << endl;
+            return 1;
+        }
+    }
+
+    vector<int> bytesEscalera;
+    leerEscalera("geom:4096:" + to_string(static_cast<long long>(hasta)) + ":" + to_string(static_cast<int>(puntos)), bytesEscalera);
+    densificarAlrededorDeCaches(bytesEscalera, 1);
+    bytesEscalera.erase(remove_if(bytesEscalera.begin(), bytesEscalera.end(), [hasta](int bytes) { return bytes > hasta; }), bytesEscalera.end());
+
+    vector<CargaCache> cargas;
+    for (CargaCache& carga : definirCargas(barrido.arnes.paginas)) {
+        if (nombresCargas.empty() || find(nombresCargas.begin(), nombresCargas.end(), carga.nombre) != nombresCargas.end()) cargas.push_back(move(carga));
+    }
+    if (cargas.empty()) {
+        cerr << "Ninguna carga coincide con --cargas (mezcla, bst, lista)" << endl;
+        return 1;
+    }
+
+    vector<vector<PuntoCache>> puntosCargas;
+    for (const CargaCache& carga : cargas) puntosCargas.push_back(barrerCarga(carga, bytesEscalera, barrido.arnes));
+    imprimirFragmentos(cargas, niveles);
+
+    QApplication app(argc, argv);
+
+    QCustomPlot grafico;
+    graficarJerarquia(&grafico, cargas, puntosCargas, niveles);
+    grafico.setWindowTitle("Tiempo por operación contra conjunto de trabajo");
+    grafico.resize(1000, 600);
+    grafico.show();
+
+    return app.exec();
+}
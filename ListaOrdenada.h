@@ -0,0 +1,59 @@
+#ifndef LISTAORDENADA_H
+#define LISTAORDENADA_H
+
+#include <cstdint>
+#include <list>      // Para std::list
+#include <vector>
+#include "GeneradoresEntrada.h" // Orden reproducible del caso promedio
+#include "PoliticaConteo.h"     // Conteo de visitas y comparaciones
+
+// Búsqueda en lista enlazada ordenada y generadores de sus casos, compartidos por la versión
+// gráfica (SortedLinkedList.cpp) y la de consola (BenchmarkConsola.cpp)
+
+// Algoritmo para buscar en una lista enlazada ordenada
+template <class Politica = ConteoNulo>
+bool buscarEnListaOrdenada(const std::list<int>& lista, int valor) {
+    for (const auto& elemento : lista) {
+        Politica::visita();
+        Politica::comparacion();
+        if (elemento == valor) {
+            return true;
+        }
+        Politica::comparacion();
+        if (elemento > valor) {
+            break; // La lista está ordenada, no es necesario continuar
+        }
+    }
+    return false;
+}
+
+// Genera una lista ordenada (Mejor caso)
+inline std::list<int> generarListaOrdenada(int n) {
+    std::list<int> lista;
+    for (int i = 0; i < n; ++i) {
+        lista.push_back(i);
+    }
+    return lista;
+}
+
+// Genera una lista en orden inverso (Peor caso)
+inline std::list<int> generarListaPeorCaso(int n) {
+    std::list<int> lista;
+    for (int i = n - 1; i >= 0; --i) {
+        lista.push_back(i);
+    }
+    return lista;
+}
+
+// Genera una lista aleatoria (Caso promedio); la semilla fija el orden
+inline std::list<int> generarListaCasoPromedio(int n, uint64_t semilla) {
+    std::vector<int> vectorTemp = generarCasoPromedio(n, semilla);
+    std::list<int> lista(vectorTemp.begin(), vectorTemp.end());
+    return lista;
+}
+
+inline std::list<int> generarListaCasoPromedio(int n) {
+    return generarListaCasoPromedio(n, semillaEntradas);
+}
+
+#endif // LISTAORDENADA_H
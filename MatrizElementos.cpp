@@ -0,0 +1,257 @@
+#include "qcustomplot.h"
+#include <QApplication>
+#include <QVector>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "Ordenamientos.h" // Algoritmos de ordenamiento genéricos
+#include "OrdenamientoIndirecto.h" // Argsort y modo clave/carga
+#include "GeneradoresEntrada.h"    // Entradas reproducibles
+#include "ArnesBenchmark.h"        // Repeticiones y medianas de cada celda
+
+using namespace std;
+
+// Registro de 64 bytes: se ordena por la clave mediante una proyección
+struct Registro64 {
+    int64_t clave;
+    char carga[56];
+};
+
+// Registro con clave de 32 bits y carga útil hasta completar Bytes
+template <size_t Bytes>
+struct RegistroCarga {
+    int32_t clave;
+    char carga[Bytes - sizeof(int32_t)];
+};
+
+template <>
+struct RegistroCarga<4> {
+    int32_t clave;
+};
+
+// Convierte el valor entero generado al tipo de elemento que se está midiendo
+template <class T>
+T convertirElemento(int valor) {
+    return static_cast<T>(valor);
+}
+
+template <>
+string convertirElemento<string>(int valor) {
+    return "elemento-" + to_string(valor);
+}
+
+// Los registros guardan el valor generado en su clave
+template <class T>
+T convertirRegistro(int valor) {
+    T registro{};
+    registro.clave = valor;
+    return registro;
+}
+
+// Genera un caso promedio (aleatorio, con la semilla por defecto) del tipo indicado
+template <class T>
+vector<T> generarCasoPromedio(int n) {
+    vector<int> valores = generarEntrada(Distribucion::Aleatoria, n);
+
+    vector<T> arreglo;
+    arreglo.reserve(n);
+    for (int v : valores) {
+        if constexpr (requires(T t) { t.clave; }) {
+            arreglo.push_back(convertirRegistro<T>(v));
+        } else {
+            arreglo.push_back(convertirElemento<T>(v));
+        }
+    }
+    return arreglo;
+}
+
+// Medianas de los tres algoritmos para un tipo de elemento
+struct ResultadoTipo {
+    string nombre;
+    size_t ancho; // Bytes por elemento
+    vector<double> tiemposBurbuja, tiemposSeleccion, tiemposMezcla;
+};
+
+// Mide los tres algoritmos sobre el mismo caso promedio de tipo T; cada punto es la mediana
+// de las repeticiones del arnés (los n pequeños se miden en lotes)
+template <class T, class Proj = identity>
+ResultadoTipo medirTipo(const string& nombre, const vector<int>& tamanos, Proj proj = {}) {
+    ConfiguracionArnes configuracion;
+    ResultadoTipo resultado{nombre, sizeof(T), {}, {}, {}};
+    for (int n : tamanos) {
+        const vector<T> original = generarCasoPromedio<T>(n);
+        auto copiar = [&] { return original; };
+
+        resultado.tiemposBurbuja.push_back(medirCelda(copiar, [&](vector<T>& datos) { ordenarBurbuja(datos, ranges::less{}, proj); }, configuracion).mediana);
+        resultado.tiemposSeleccion.push_back(medirCelda(copiar, [&](vector<T>& datos) { ordenamientoPorSeleccion(datos, ranges::less{}, proj); }, configuracion).mediana);
+        resultado.tiemposMezcla.push_back(medirCelda(copiar, [&](vector<T>& datos) { ordenarPorMezcla(datos, ranges::less{}, proj); }, configuracion).mediana);
+    }
+    return resultado;
+}
+
+// Primer tamaño a partir del cual el algoritmo rápido gana siempre al lento (0 si nunca)
+int puntoDeCruce(const vector<int>& tamanos, const vector<double>& lento, const vector<double>& rapido) {
+    int cruce = 0;
+    for (size_t i = 0; i < tamanos.size(); ++i) {
+        if (rapido[i] >= lento[i]) {
+            cruce = 0;
+        } else if (cruce == 0) {
+            cruce = tamanos[i];
+        }
+    }
+    return cruce;
+}
+
+// Ejecuta la matriz tipo x algoritmo x tamaño
+vector<ResultadoTipo> ejecutarMatriz(const vector<int>& tamanos) {
+    vector<ResultadoTipo> resultados;
+    resultados.push_back(medirTipo<int32_t>("int32_t", tamanos));
+    resultados.push_back(medirTipo<int64_t>("int64_t", tamanos));
+    resultados.push_back(medirTipo<double>("double", tamanos));
+    resultados.push_back(medirTipo<string>("string", tamanos));
+    resultados.push_back(medirTipo<Registro64>("Registro64", tamanos, &Registro64::clave));
+    return resultados;
+}
+
+// Imprime la matriz y los puntos de cruce en la consola
+void imprimirMatriz(const vector<int>& tamanos, const vector<ResultadoTipo>& resultados) {
+    cout << "tipo\tbytes\tn\tburbuja(ns)\tseleccion(ns)\tmezcla(ns)   [medianas]" << endl;
+    for (const ResultadoTipo& r : resultados) {
+        for (size_t i = 0; i < tamanos.size(); ++i) {
+            cout << r.nombre << "\t" << r.ancho << "\t" << tamanos[i] << "\t" << r.tiemposBurbuja[i] << "\t"
+                 << r.tiemposSeleccion[i] << "\t" << r.tiemposMezcla[i] << endl;
+        }
+    }
+
+    cout << endl << "tipo\tcruce mezcla/burbuja\tcruce mezcla/seleccion" << endl;
+    for (const ResultadoTipo& r : resultados) {
+        cout << r.nombre << "\t" << puntoDeCruce(tamanos, r.tiemposBurbuja, r.tiemposMezcla) << "\t"
+             << puntoDeCruce(tamanos, r.tiemposSeleccion, r.tiemposMezcla) << endl;
+    }
+}
+
+// Medianas de ordenamiento directo e indirecto para un ancho de registro
+struct ResultadoIndirecto {
+    size_t ancho;
+    double directo, indices, pares;
+};
+
+// Ordena el mismo caso promedio moviendo los registros, con argsort de índices y con pares clave/índice
+template <size_t Bytes>
+ResultadoIndirecto medirIndirecto(int n) {
+    using Registro = RegistroCarga<Bytes>;
+    ConfiguracionArnes configuracion;
+    const vector<Registro> original = generarCasoPromedio<Registro>(n);
+    auto copiar = [&] { return original; };
+    ResultadoIndirecto resultado{Bytes, 0, 0, 0};
+
+    resultado.directo = medirCelda(copiar, [](vector<Registro>& datos) { ordenarPorMezcla(datos, ranges::less{}, &Registro::clave); }, configuracion).mediana;
+    resultado.indices = medirCelda(copiar, [](vector<Registro>& datos) {
+        aplicarPermutacion(datos, argsortPorMezcla(datos, ranges::less{}, &Registro::clave));
+    }, configuracion).mediana;
+    resultado.pares = medirCelda(copiar, [](vector<Registro>& datos) { aplicarPermutacion(datos, argsortPorPares(datos, &Registro::clave)); }, configuracion).mediana;
+    return resultado;
+}
+
+// Compara ordenamiento directo contra indirecto con carga de 4 a 256 bytes
+vector<ResultadoIndirecto> compararDirectoIndirecto(int n) {
+    vector<ResultadoIndirecto> resultados = {
+        medirIndirecto<4>(n), medirIndirecto<8>(n), medirIndirecto<16>(n), medirIndirecto<32>(n),
+        medirIndirecto<64>(n), medirIndirecto<128>(n), medirIndirecto<256>(n)
+    };
+
+    cout << endl << "bytes\tdirecto(ns)\tindices(ns)\tpares(ns)   [n = " << n << ", medianas]" << endl;
+    for (const ResultadoIndirecto& r : resultados) {
+        cout << r.ancho << "\t" << r.directo << "\t" << r.indices << "\t" << r.pares << endl;
+    }
+    return resultados;
+}
+
+// Grafica el punto de cruce contra el ancho del elemento
+void graficarCruces(QCustomPlot* grafico, const vector<int>& tamanos, vector<ResultadoTipo> resultados) {
+    sort(resultados.begin(), resultados.end(), [](const ResultadoTipo& a, const ResultadoTipo& b) { return a.ancho < b.ancho; });
+
+    QVector<double> x, yBurbuja, ySeleccion;
+    for (const ResultadoTipo& r : resultados) {
+        x.push_back(r.ancho);
+        yBurbuja.push_back(puntoDeCruce(tamanos, r.tiemposBurbuja, r.tiemposMezcla));
+        ySeleccion.push_back(puntoDeCruce(tamanos, r.tiemposSeleccion, r.tiemposMezcla));
+    }
+
+    grafico->addGraph();
+    grafico->graph(0)->setData(x, yBurbuja);
+    grafico->graph(0)->setPen(QPen(Qt::blue));
+    grafico->graph(0)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 6));
+    grafico->graph(0)->setName("Cruce Mezcla vs Burbuja");
+
+    grafico->addGraph();
+    grafico->graph(1)->setData(x, ySeleccion);
+    grafico->graph(1)->setPen(QPen(Qt::red));
+    grafico->graph(1)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, 6));
+    grafico->graph(1)->setName("Cruce Mezcla vs Selección");
+
+    grafico->xAxis->setLabel("Ancho del elemento (bytes)");
+    grafico->yAxis->setLabel("Tamaño de cruce (n)");
+    grafico->rescaleAxes();
+    grafico->yAxis->setRangeLower(0);
+
+    grafico->legend->setVisible(true);
+    grafico->replot();
+}
+
+// Grafica el tiempo de cada modo contra el ancho del registro
+void graficarIndirecto(QCustomPlot* grafico, const vector<ResultadoIndirecto>& resultados) {
+    QVector<double> x, yDirecto, yIndices, yPares;
+    for (const ResultadoIndirecto& r : resultados) {
+        x.push_back(r.ancho);
+        yDirecto.push_back(r.directo);
+        yIndices.push_back(r.indices);
+        yPares.push_back(r.pares);
+    }
+
+    grafico->addGraph();
+    grafico->graph(0)->setData(x, yDirecto);
+    grafico->graph(0)->setPen(QPen(Qt::blue));
+    grafico->graph(0)->setName("Directo (mueve registros)");
+
+    grafico->addGraph();
+    grafico->graph(1)->setData(x, yIndices);
+    grafico->graph(1)->setPen(QPen(Qt::red));
+    grafico->graph(1)->setName("Indirecto (índices de 32 bits)");
+
+    grafico->addGraph();
+    grafico->graph(2)->setData(x, yPares);
+    grafico->graph(2)->setPen(QPen(Qt::green));
+    grafico->graph(2)->setName("Indirecto (pares clave/índice)");
+
+    grafico->xAxis->setLabel("Ancho del registro (bytes)");
+    grafico->yAxis->setLabel("Tiempo (nanosegundos)");
+    grafico->rescaleAxes();
+    grafico->yAxis->setRangeLower(0);
+
+    grafico->legend->setVisible(true);
+    grafico->replot();
+}
+
+int main(int argc, char *argv[]) {
+    vector<int> tamanos = {4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048};
+
+    vector<ResultadoTipo> resultados = ejecutarMatriz(tamanos);
+    imprimirMatriz(tamanos, resultados);
+    vector<ResultadoIndirecto> resultadosIndirectos = compararDirectoIndirecto(100000);
+
+    QApplication app(argc, argv);
+
+    QCustomPlot graficoCruces;
+    graficarCruces(&graficoCruces, tamanos, resultados);
+    graficoCruces.resize(800, 600);
+    graficoCruces.show();
+
+    QCustomPlot graficoIndirecto;
+    graficarIndirecto(&graficoIndirecto, resultadosIndirectos);
+    graficoIndirecto.resize(800, 600);
+    graficoIndirecto.show();
+
+    return app.exec();
+}
@@ -0,0 +1,169 @@
+#ifndef MEDICIONMEMORIA_H
+#define MEDICIONMEMORIA_H
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+// Medición de memoria de una región: reservas, bytes reservados y pico de bytes vivos (con los
+// ganchos de operator new/delete de GanchosMemoria.h, por hilo), pico de RSS del proceso por
+// encima del RSS al empezar (/proc/self/status) y fallos de página menores del hilo
+// (getrusage). Sin los ganchos, las métricas de reservas quedan en -1.
+
+// Contadores de los ganchos, propios de cada hilo: una celda solo ve sus reservas aunque otras
+// celdas corran en paralelo. Un bloque liberado en otro hilo descuenta sus bytes vivos allí.
+struct ContadoresMemoria {
+    long long asignaciones = 0;
+    long long bytesAsignados = 0;
+    long long bytesVivos = 0;
+    long long picoVivos = 0;
+};
+
+inline thread_local ContadoresMemoria contadoresMemoriaHilo;
+
+// Lo pone en true GanchosMemoria.h al incluirse en el programa
+inline bool ganchosMemoriaInstalados = false;
+
+enum MetricaMemoria {
+    MemoriaAsignaciones, // Llamadas a operator new
+    MemoriaBytes,        // Bytes pedidos a operator new
+    MemoriaPicoVivos,    // Máximo de bytes vivos por encima de los vivos al empezar
+    MemoriaPicoRss,      // Máximo del RSS del proceso por encima del RSS al empezar (bytes)
+    MemoriaFallosPagina, // Fallos de página menores del hilo
+    NumMetricasMemoria
+};
+
+inline const char* nombreMetricaMemoria(int metrica) {
+    static const char* nombres[NumMetricasMemoria] = {"reservas", "bytes reservados", "pico de bytes vivos", "pico de RSS",
+                                                     "fallos de página"};
+    return nombres[metrica];
+}
+
+// Nombre de la métrica como identificador, para columnas CSV y claves JSON
+inline const char* claveMetricaMemoria(int metrica) {
+    static const char* claves[NumMetricasMemoria] = {"reservas", "bytes_reservados", "pico_vivos", "pico_rss", "fallos_pagina"};
+    return claves[metrica];
+}
+
+// Valores de una región; -1 indica que la métrica no está disponible
+struct LecturaMemoria {
+    long long valores[NumMetricasMemoria];
+
+    LecturaMemoria() { std::fill(valores, valores + NumMetricasMemoria, -1LL); }
+
+    bool disponible(int metrica) const { return valores[metrica] >= 0; }
+
+    bool algunaDisponible() const {
+        return std::any_of(valores, valores + NumMetricasMemoria, [](long long v) { return v >= 0; });
+    }
+
+    double porElemento(int metrica, long long n) const {
+        if (!disponible(metrica) || n <= 0) return -1;
+        return static_cast<double>(valores[metrica]) / n;
+    }
+};
+
+// Mediana métrica por métrica de varias lecturas (las repeticiones de una celda)
+inline LecturaMemoria medianaMemoria(const std::vector<LecturaMemoria>& lecturas) {
+    LecturaMemoria resultado;
+    for (int m = 0; m < NumMetricasMemoria; m++) {
+        std::vector<long long> valores;
+        for (const LecturaMemoria& lectura : lecturas) {
+            if (lectura.disponible(m)) valores.push_back(lectura.valores[m]);
+        }
+        if (valores.empty()) continue;
+        std::nth_element(valores.begin(), valores.begin() + valores.size() / 2, valores.end());
+        resultado.valores[m] = valores[valores.size() / 2];
+    }
+    return resultado;
+}
+
+// Campo en kB de /proc/self/status ("VmRSS", "VmHWM"), en bytes; -1 si no se puede leer
+inline long long leerEstadoProcesoBytes(const char* campo) {
+#ifdef __linux__
+    FILE* archivo = std::fopen("/proc/self/status", "r");
+    if (!archivo) return -1;
+    char linea[256];
+    long long kb = -1;
+    size_t largo = std::strlen(campo);
+    while (std::fgets(linea, sizeof(linea), archivo)) {
+        if (std::strncmp(linea, campo, largo) == 0 && linea[largo] == ':') {
+            kb = std::atoll(linea + largo + 1);
+            break;
+        }
+    }
+    std::fclose(archivo);
+    return kb < 0 ? -1 : kb * 1024;
+#else
+    (void)campo;
+    return -1;
+#endif
+}
+
+// Reinicia el pico de RSS del proceso (VmHWM) al RSS actual; false si el kernel no lo permite
+inline bool reiniciarPicoRss() {
+#ifdef __linux__
+    FILE* archivo = std::fopen("/proc/self/clear_refs", "w");
+    if (!archivo) return false;
+    bool escrito = std::fputs("5", archivo) >= 0;
+    return std::fclose(archivo) == 0 && escrito;
+#else
+    return false;
+#endif
+}
+
+inline long long fallosPaginaHilo() {
+#if defined(__linux__) && defined(RUSAGE_THREAD)
+    rusage uso;
+    if (getrusage(RUSAGE_THREAD, &uso) != 0) return -1;
+    return uso.ru_minflt;
+#else
+    return -1;
+#endif
+}
+
+// Región medida: iniciar() y detener() quedan fuera del cronómetro (leen /proc). El pico de
+// RSS es del proceso completo: con celdas en paralelo incluye la memoria de las demás.
+class RegionMemoria {
+public:
+    void iniciar() {
+        rssInicial = leerEstadoProcesoBytes("VmRSS");
+        picoReiniciado = rssInicial >= 0 && reiniciarPicoRss();
+        fallosIniciales = fallosPaginaHilo();
+        inicial = contadoresMemoriaHilo;
+        contadoresMemoriaHilo.picoVivos = contadoresMemoriaHilo.bytesVivos;
+    }
+
+    LecturaMemoria detener() {
+        ContadoresMemoria actual = contadoresMemoriaHilo;
+        LecturaMemoria lectura;
+        if (ganchosMemoriaInstalados) {
+            lectura.valores[MemoriaAsignaciones] = actual.asignaciones - inicial.asignaciones;
+            lectura.valores[MemoriaBytes] = actual.bytesAsignados - inicial.bytesAsignados;
+            lectura.valores[MemoriaPicoVivos] = std::max(0LL, actual.picoVivos - inicial.bytesVivos);
+        }
+        // El pico del hilo se restaura para que una región no oculte el de una región externa
+        contadoresMemoriaHilo.picoVivos = std::max(actual.picoVivos, inicial.picoVivos);
+        if (picoReiniciado) {
+            long long pico = leerEstadoProcesoBytes("VmHWM");
+            if (pico >= 0) lectura.valores[MemoriaPicoRss] = std::max(0LL, pico - rssInicial);
+        }
+        long long fallos = fallosPaginaHilo();
+        if (fallos >= 0 && fallosIniciales >= 0) lectura.valores[MemoriaFallosPagina] = fallos - fallosIniciales;
+        return lectura;
+    }
+
+private:
+    ContadoresMemoria inicial;
+    long long rssInicial = -1;
+    long long fallosIniciales = -1;
+    bool picoReiniciado = false;
+};
+
+#endif // MEDICIONMEMORIA_H
@@ -4,133 +4,191 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <algorithm> // Para std::shuffle
-#include <random>    // Para std::random_device y std::mt19937
 #include <cmath>     // Para funciones matemáticas
+#include "ContadorHardware.h" // Para contar fallos de predicción de saltos
+#include "Ordenamientos.h"    // Merge Sort genérico y sus núcleos de mezcla
+#include "OrdenamientoParcial.h" // Top-k: montículo acotado, introselect y flujo
+#include "OrdenamientoConteo.h"  // Ruta rápida por conteo/cubetas para claves densas
+#include "GraficasArnes.h"       // Arnés de repeticiones y barras de dispersión
+#include "GraficaEnVivo.h"       // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "GanchosMemoria.h"      // Reservas y bytes de cada repetición
+#include "ConfiguracionBarrido.h" // Tamaños desde --barrido / --tamanos
+#include "GeneradoresEntrada.h"   // Entradas reproducibles de cada caso
+#include "TuberiaEntradas.h"      // Entradas generadas en otro núcleo durante la medición
 
 using namespace std;
 using namespace std::chrono;
 
-// Función para obtener el tiempo en nanosegundos
+// Función para obtener el tiempo en nanosegundos (reloj de ciclos calibrado del arnés)
 long long obtenerTiempoEnNanoSegundos() {
-    return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+    return relojCiclos().ahoraNs();
 }
 
-// Función de mezcla para Merge Sort
-void mezclarVectores(vector<int>& arr, int izq, int medio, int der) {
-    int tamIzq = medio - izq + 1;
-    int tamDer = der - medio;
-
-    vector<int> subIzq(tamIzq);
-    vector<int> subDer(tamDer);
-
-    for (int i = 0; i < tamIzq; i++)
-        subIzq[i] = arr[izq + i];
-    for (int j = 0; j < tamDer; j++)
-        subDer[j] = arr[medio + 1 + j];
-
-    int i = 0, j = 0, k = izq;
-    while (i < tamIzq && j < tamDer) {
-        if (subIzq[i] <= subDer[j]) {
-            arr[k] = subIzq[i];
-            i++;
-        } else {
-            arr[k] = subDer[j];
-            j++;
-        }
-        k++;
-    }
+// Realiza los benchmarks y almacena los resultados
+// Cada celda se repite con el arnés; la copia de la entrada se hace fuera de la medición
+// Cada celda se publica para la gráfica en vivo en cuanto se mide; si se cerró la ventana se deja de medir
+void ejecutarBenchmarks(const vector<int>& tamanos, vector<EstadisticasCelda>& tiemposMejorCaso, vector<EstadisticasCelda>& tiemposPeorCaso, vector<EstadisticasCelda>& tiemposCasoPromedio, const PublicarCelda& publicar) {
+    ConfiguracionArnes configuracion;
+    auto ordenar = [](vector<int>& datos) { ordenarPorMezcla(datos); };
 
-    while (i < tamIzq) {
-        arr[k] = subIzq[i];
-        i++;
-        k++;
-    }
+    // Las entradas de la celda siguiente se generan en otro núcleo mientras se mide la actual
+    TuberiaEntradas<vector<int>> entradas(generadoresPorTamano<vector<int>>(tamanos, {generarMejorCaso, generarPeorCaso, [](int n) { return generarCasoPromedio(n); }}));
+
+    for (int n : tamanos) {
+        // Mejor caso
+        const vector<int>& mejorCaso = entradas.siguiente();
+        tiemposMejorCaso.push_back(medirCelda([&] { return mejorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Mejor caso", n, tiemposMejorCaso.back());
+        if (!publicar(0, n, tiemposMejorCaso.back())) return;
 
-    while (j < tamDer) {
-        arr[k] = subDer[j];
-        j++;
-        k++;
+        // Peor caso
+        const vector<int>& peorCaso = entradas.siguiente();
+        tiemposPeorCaso.push_back(medirCelda([&] { return peorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Peor caso", n, tiemposPeorCaso.back());
+        if (!publicar(1, n, tiemposPeorCaso.back())) return;
+
+        // Caso promedio
+        const vector<int>& casoPromedio = entradas.siguiente();
+        tiemposCasoPromedio.push_back(medirCelda([&] { return casoPromedio; }, ordenar, configuracion));
+        imprimirCelda(cout, "Caso promedio", n, tiemposCasoPromedio.back());
+        if (!publicar(2, n, tiemposCasoPromedio.back())) return;
     }
 }
 
-// Implementación de Merge Sort
-void ordenarPorMezcla(vector<int>& arr, int izq, int der) {
-    if (izq < der) {
-        int medio = izq + (der - izq) / 2;
+// Pasada sin cronómetro con la instanciación que cuenta operaciones; la medición de tiempo
+// usa la instanciación por defecto (ConteoNulo), que no contiene contadores
+void contarOperacionesPorCaso(const vector<int>& tamanos, vector<Operaciones>& operacionesMejorCaso, vector<Operaciones>& operacionesPeorCaso, vector<Operaciones>& operacionesPromedio) {
+    for (int n : tamanos) {
+        vector<int> mejorCaso = generarMejorCaso(n);
+        operacionesMejorCaso.push_back(contarOperaciones([&] { ordenarPorMezcla<ConteoOperaciones>(mejorCaso); }));
+        imprimirOperaciones(cout, "Mejor caso", n, operacionesMejorCaso.back());
 
-        ordenarPorMezcla(arr, izq, medio);
-        ordenarPorMezcla(arr, medio + 1, der);
+        vector<int> peorCaso = generarPeorCaso(n);
+        operacionesPeorCaso.push_back(contarOperaciones([&] { ordenarPorMezcla<ConteoOperaciones>(peorCaso); }));
+        imprimirOperaciones(cout, "Peor caso", n, operacionesPeorCaso.back());
 
-        mezclarVectores(arr, izq, medio, der);
+        vector<int> casoPromedio = generarCasoPromedio(n);
+        operacionesPromedio.push_back(contarOperaciones([&] { ordenarPorMezcla<ConteoOperaciones>(casoPromedio); }));
+        imprimirOperaciones(cout, "Caso promedio", n, operacionesPromedio.back());
     }
 }
 
-// Genera un array en el mejor caso (ordenado)
-vector<int> generarMejorCaso(int n) {
-    vector<int> arreglo(n);
-    for (int i = 0; i < n; i++) {
-        arreglo[i] = i;
+// Compara los núcleos de mezcla con datos ordenados y aleatorios, midiendo tiempo y fallos de salto
+void compararNucleosMezcla(const vector<int>& tamanos) {
+    ContadorHardware fallosSalto;
+    if (!fallosSalto.disponible()) {
+        cout << "Contador de fallos de salto no disponible (revise /proc/sys/kernel/perf_event_paranoid)" << endl;
     }
-    return arreglo;
-}
 
-// Genera un array en el peor caso (orden inverso)
-vector<int> generarPeorCaso(int n) {
-    vector<int> arreglo(n);
-    for (int i = 0; i < n; i++) {
-        arreglo[i] = n - i;
+    const NucleoMezcla nucleos[] = {NucleoMezcla::Clasico, NucleoMezcla::SinSaltos, NucleoMezcla::Bidireccional};
+    cout << "n\tcaso\tnucleo\ttiempo(ns)\tfallos de salto" << endl;
+    for (int n : tamanos) {
+        for (int caso = 0; caso < 2; caso++) {
+            vector<int> original = caso == 0 ? generarMejorCaso(n) : generarCasoPromedio(n);
+            for (NucleoMezcla nucleo : nucleos) {
+                vector<int> datos = original;
+                fallosSalto.iniciar();
+                long long inicio = obtenerTiempoEnNanoSegundos();
+                ordenarPorMezcla(datos, nucleo);
+                long long fin = obtenerTiempoEnNanoSegundos();
+                fallosSalto.detener();
+
+                cout << n << "\t" << (caso == 0 ? "ordenado" : "aleatorio") << "\t" << nombreNucleo(nucleo)
+                     << "\t" << (fin - inicio) << "\t" << fallosSalto.leer() << endl;
+            }
+        }
     }
-    return arreglo;
 }
 
-// Genera un array en un caso promedio (aleatorio)
-vector<int> generarCasoPromedio(int n) {
-    vector<int> arreglo(n);
-    for (int i = 0; i < n; i++) {
-        arreglo[i] = i;
+// Mide cuándo la detección de rango se paga sola: claves densas (los tres casos del proyecto),
+// claves espaciadas (cubetas), claves agrupadas en unas pocas cubetas y claves dispersas,
+// donde la detección es puro costo extra
+void compararRutaConteo(const vector<int>& tamanos) {
+    ConfiguracionArnes configuracion;
+    cout << endl << "n\tcaso\tmerge(ns)\tdeteccion(ns)\truta rapida(ns)\testrategia   [medianas]" << endl;
+    for (int n : tamanos) {
+        vector<int> espaciado = generarCasoPromedio(n);
+        for (int& v : espaciado) v *= 16;
+        vector<int> disperso = generarCasoPromedio(n);
+        for (int& v : disperso) v = (int)((unsigned)v * 2654435761u); // Dispersión multiplicativa
+        // n-1 claves en [0, 64) y una en 64n-1: entra en cubetas, pero casi todo cae en la primera
+        vector<int> agrupado = generarCasoPromedio(n);
+        for (int& v : agrupado) v %= 64;
+        agrupado.back() = 64 * n - 1;
+
+        const pair<const char*, vector<int>> casos[] = {
+            {"mejor", generarMejorCaso(n)}, {"peor", generarPeorCaso(n)}, {"promedio", generarCasoPromedio(n)},
+            {"espaciado x16", espaciado}, {"agrupado", agrupado}, {"disperso", disperso}
+        };
+        for (const auto& [nombre, original] : casos) {
+            EstadisticasCelda mezcla = medirCelda([&] { return original; }, [](vector<int>& datos) { ordenarPorMezcla(datos); }, configuracion);
+            // La detección solo lee la entrada: se mide sobre la misma copia
+            EstadisticasCelda deteccion = medirCelda([&]() -> const vector<int>& { return original; },
+                                                     [](const vector<int>& datos) { evitarOptimizacion(detectarRango(datos.data(), datos.size())); },
+                                                     configuracion);
+            EstadisticasCelda ruta = medirCelda([&] { return original; }, [](vector<int>& datos) { ordenarEnteros(datos); }, configuracion);
+
+            RangoClaves rango = detectarRango(original.data(), original.size());
+            vector<int> datos = original;
+            EstrategiaEnteros estrategia = ordenarEnteros(datos);
+            cout << n << "\t" << nombre << "\t" << mezcla.mediana << "\t" << deteccion.mediana << "\t" << ruta.mediana
+                 << "\t" << nombreEstrategia(estrategia) << " [" << rango.minimo << ", " << rango.maximo << "]" << endl;
+        }
     }
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(arreglo.begin(), arreglo.end(), g);
-    return arreglo;
 }
 
-// Realiza los benchmarks y almacena los resultados
-void ejecutarBenchmarks(const vector<int>& tamanos, vector<long long>& tiemposMejorCaso, vector<long long>& tiemposPeorCaso, vector<long long>& tiemposCasoPromedio) {
-    for (int n : tamanos) {
-        // Mejor caso
-        vector<int> mejorCaso = generarMejorCaso(n);
-        long long inicio = obtenerTiempoEnNanoSegundos();
-        ordenarPorMezcla(mejorCaso, 0, n - 1);
-        long long fin = obtenerTiempoEnNanoSegundos();
-        tiemposMejorCaso.push_back(fin - inicio);
-
-        // Peor caso
-        vector<int> peorCaso = generarPeorCaso(n);
-        inicio = obtenerTiempoEnNanoSegundos();
-        ordenarPorMezcla(peorCaso, 0, n - 1);
-        fin = obtenerTiempoEnNanoSegundos();
-        tiemposPeorCaso.push_back(fin - inicio);
-
-        // Caso promedio
-        vector<int> casoPromedio = generarCasoPromedio(n);
-        inicio = obtenerTiempoEnNanoSegundos();
-        ordenarPorMezcla(casoPromedio, 0, n - 1);
-        fin = obtenerTiempoEnNanoSegundos();
-        tiemposCasoPromedio.push_back(fin - inicio);
+// Medianas de las estrategias de top-k para una fracción k/n
+struct ResultadoParcial {
+    double fraccion;
+    double monticulo, seleccion, flujo, completo;
+};
+
+// Compara las estrategias de ordenamiento parcial contra ordenar todo con Merge Sort; las
+// fracciones alrededor de 1% son las que fijan el umbral de ordenarParcial
+vector<ResultadoParcial> compararOrdenamientoParcial(int n) {
+    const double fracciones[] = {0.00001, 0.0001, 0.001, 0.005, 0.01, 0.02, 0.1, 0.5};
+    const int tamBloque = 4096;
+    ConfiguracionArnes configuracion;
+    const vector<int> original = generarCasoPromedio(n);
+    auto copiar = [&] { return original; };
+
+    double tiempoCompleto = medirCelda(copiar, [](vector<int>& datos) { ordenarPorMezcla(datos); }, configuracion).mediana;
+
+    vector<ResultadoParcial> resultados;
+    cout << endl << "k/n\tk\tmonticulo(ns)\tintroselect(ns)\tflujo(ns)\tmerge completo(ns)   [n = " << n << ", medianas]" << endl;
+    for (double fraccion : fracciones) {
+        int k = max(1, (int)(fraccion * n));
+        ResultadoParcial r{fraccion, 0, 0, 0, tiempoCompleto};
+
+        r.monticulo = medirCelda(copiar, [k](vector<int>& datos) { ordenarParcialMonticulo(datos.begin(), datos.begin() + k, datos.end()); }, configuracion).mediana;
+        r.seleccion = medirCelda(copiar, [k](vector<int>& datos) { ordenarParcialSeleccion(datos.begin(), datos.begin() + k, datos.end()); }, configuracion).mediana;
+
+        // El flujo recibe la entrada por bloques, como si llegara de un archivo o de la red; no
+        // la modifica, así que todas las repeticiones leen la misma
+        r.flujo = medirCelda([&]() -> const vector<int>& { return original; }, [&](const vector<int>& datos) {
+            TopKEnFlujo<int> flujo(k);
+            for (int desde = 0; desde < n; desde += tamBloque) {
+                flujo.consumir(datos.begin() + desde, datos.begin() + min(n, desde + tamBloque));
+            }
+            evitarOptimizacion(flujo.resultado());
+        }, configuracion).mediana;
+
+        cout << fraccion * 100 << "%\t" << k << "\t" << r.monticulo << "\t" << r.seleccion << "\t" << r.flujo
+             << "\t" << r.completo << endl;
+        resultados.push_back(r);
     }
+    return resultados;
 }
 
 // Función para graficar resultados de benchmarks
-void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const vector<long long>& tiemposMejor, const vector<long long>& tiemposPeor, const vector<long long>& tiemposPromedio) {
+void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const vector<EstadisticasCelda>& tiemposMejor, const vector<EstadisticasCelda>& tiemposPeor, const vector<EstadisticasCelda>& tiemposPromedio) {
     QVector<double> x(tamanos.size()), yMejor(tamanos.size()), yPeor(tamanos.size()), yPromedio(tamanos.size());
 
     for (size_t i = 0; i < tamanos.size(); ++i) {
         x[i] = tamanos[i];
-        yMejor[i] = tiemposMejor[i];
-        yPeor[i] = tiemposPeor[i];
-        yPromedio[i] = tiemposPromedio[i];
+        yMejor[i] = tiemposMejor[i].mediana;
+        yPeor[i] = tiemposPeor[i].mediana;
+        yPromedio[i] = tiemposPromedio[i].mediana;
     }
 
     // Graficar mejor caso
@@ -151,73 +209,137 @@ void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const
     grafico->graph(2)->setPen(QPen(Qt::green));
     grafico->graph(2)->setName("Caso Promedio O(nlogn)");
 
+    // Dispersión de las repeticiones (percentiles 5 a 95)
+    agregarDispersion(grafico, grafico->graph(0), tiemposMejor);
+    agregarDispersion(grafico, grafico->graph(1), tiemposPeor);
+    agregarDispersion(grafico, grafico->graph(2), tiemposPromedio);
+
+    // Curvas del mejor modelo ajustado por mínimos cuadrados a las medianas
+    agregarAjuste(grafico, grafico->graph(0), "Mejor Caso", tamanos, ajustarComplejidad(tamanos, tiemposMejor));
+    agregarAjuste(grafico, grafico->graph(1), "Peor Caso", tamanos, ajustarComplejidad(tamanos, tiemposPeor));
+    agregarAjuste(grafico, grafico->graph(2), "Caso Promedio", tamanos, ajustarComplejidad(tamanos, tiemposPromedio));
+
     // Ajustar etiquetas y rango de ejes
     grafico->xAxis->setLabel("Tamaño de entrada (n)");
     grafico->yAxis->setLabel("Tiempo (nanosegundos)");
 
     grafico->xAxis->setRange(0, tamanos.back());
-    grafico->yAxis->setRange(0, *max_element(yPeor.begin(), yPeor.end()) + 100);
+    grafico->yAxis->setRange(0, maximoConDispersion(tiemposPeor) + 100);
 
     // Mostrar leyenda y replotear
     grafico->legend->setVisible(true);
     grafico->replot();
 }
 
-// Función para graficar la complejidad teórica
-void graficarTeoria(QCustomPlot* grafico, const vector<int>& tamanos) {
-    QVector<double> x(tamanos.size()), yTeoricoMejor(tamanos.size()), yTeoricoPeor(tamanos.size()), yTeoricoPromedio(tamanos.size());
+// Graficar las operaciones contadas de cada caso (en lugar de fórmulas escritas a mano)
+void graficarOperacionesContadas(QCustomPlot* grafico, const vector<int>& tamanos, const vector<Operaciones>& operacionesMejorCaso, const vector<Operaciones>& operacionesPeorCaso, const vector<Operaciones>& operacionesPromedio) {
+    graficarOperaciones(grafico, tamanos, {
+        {"Mejor Caso O(n log n)", Qt::blue, operacionesMejorCaso},
+        {"Peor Caso O(n log n)", Qt::red, operacionesPeorCaso},
+        {"Caso Promedio O(n log n)", Qt::darkGreen, operacionesPromedio},
+    });
+}
 
-    for (size_t i = 0; i < tamanos.size(); ++i) {
-        x[i] = tamanos[i];
-        yTeoricoMejor[i] = pow(tamanos[i], 2); 
-        yTeoricoPeor[i] = pow(tamanos[i], 2); 
-        yTeoricoPromedio[i] = pow(tamanos[i], 2);   
+// Grafica el tiempo de cada estrategia de top-k contra k/n (escala logarítmica)
+void graficarParcial(QCustomPlot* grafico, const vector<ResultadoParcial>& resultados) {
+    QVector<double> x, yMonticulo, ySeleccion, yFlujo, yCompleto;
+    for (const ResultadoParcial& r : resultados) {
+        x.push_back(r.fraccion * 100);
+        yMonticulo.push_back(r.monticulo);
+        ySeleccion.push_back(r.seleccion);
+        yFlujo.push_back(r.flujo);
+        yCompleto.push_back(r.completo);
     }
 
     grafico->addGraph();
-    grafico->graph(0)->setData(x, yTeoricoMejor);
-    grafico->graph(0)->setPen(QPen(Qt::blue, 2));
-    grafico->graph(0)->setName("Mejor Caso (Teórico) O(nlogn)");
+    grafico->graph(0)->setData(x, yMonticulo);
+    grafico->graph(0)->setPen(QPen(Qt::blue));
+    grafico->graph(0)->setName("Montículo acotado");
 
     grafico->addGraph();
-    grafico->graph(1)->setData(x, yTeoricoPeor);
-    grafico->graph(1)->setPen(QPen(Qt::red, 2));
-    grafico->graph(1)->setName("Peor Caso (Teórico) O(nlogn)");
+    grafico->graph(1)->setData(x, ySeleccion);
+    grafico->graph(1)->setPen(QPen(Qt::red));
+    grafico->graph(1)->setName("Introselect + Merge Sort");
 
     grafico->addGraph();
-    grafico->graph(2)->setData(x, yTeoricoPromedio);
-    grafico->graph(2)->setPen(QPen(Qt::green, 2));
-    grafico->graph(2)->setName("Caso Promedio (Teórico) O(nlogn)");
+    grafico->graph(2)->setData(x, yFlujo);
+    grafico->graph(2)->setPen(QPen(Qt::green));
+    grafico->graph(2)->setName("Top-k en flujo");
 
-    grafico->xAxis->setLabel("Tamaño de entrada (n)");
-    grafico->yAxis->setLabel("Operaciones");
+    grafico->addGraph();
+    grafico->graph(3)->setData(x, yCompleto);
+    grafico->graph(3)->setPen(QPen(Qt::black, 1, Qt::DashLine));
+    grafico->graph(3)->setName("Merge Sort completo");
 
-    grafico->xAxis->setRange(0, tamanos.back());
-    grafico->yAxis->setRange(0, pow(tamanos.back(), 2));
+    grafico->xAxis->setLabel("k/n (%)");
+    grafico->yAxis->setLabel("Tiempo (nanosegundos)");
+    grafico->xAxis->setScaleType(QCPAxis::stLogarithmic);
+    grafico->xAxis->setTicker(QSharedPointer<QCPAxisTickerLog>(new QCPAxisTickerLog));
+    grafico->rescaleAxes();
+    grafico->yAxis->setRangeLower(0);
 
     grafico->legend->setVisible(true);
     grafico->replot();
 }
 
 int main(int argc, char *argv[]) {
-    vector<int> tamanos = {100, 1000, 5000, 10000, 50000}; 
-    vector<long long> tiemposMejor, tiemposPeor, tiemposPromedio;
-
-    ejecutarBenchmarks(tamanos, tiemposMejor, tiemposPeor, tiemposPromedio);
+    vector<int> tamanos = tamanosDeArgumentos(argc, argv, {100, 1000, 5000, 10000, 50000});
+    // --parcial n: compara además las estrategias de top-k sobre n elementos (no corre por defecto)
+    int nParcial = 0;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (string(argv[i]) == "--parcial") nParcial = atoi(argv[i + 1]);
+    }
+    vector<EstadisticasCelda> tiemposMejor, tiemposPeor, tiemposPromedio;
+    vector<Operaciones> operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio;
+    vector<ResultadoParcial> resultadosParciales;
 
+    // La ventana de resultados se abre antes de medir y recibe cada celda desde el hilo de trabajo
     QApplication app(argc, argv);
 
-    QCustomPlot graficoResultados;
-    graficoResultados.legend->setVisible(true);
-    graficarResultados(&graficoResultados, tamanos, tiemposMejor, tiemposPeor, tiemposPromedio);
+    QCustomPlot graficoResultados, graficoOperaciones, graficoContadores, graficoMemoria, graficoParcial;
+    MedicionEnVivo enVivo(&graficoResultados, {{"Mejor Caso O(nlogn)", Qt::blue}, {"Peor Caso O(nlogn)", Qt::red}, {"Caso Promedio O(nlogn)", Qt::green}});
     graficoResultados.resize(800, 600);
     graficoResultados.show();
 
-    QCustomPlot graficoTeorico;
-    graficarTeoria(&graficoTeorico, tamanos);
-    graficoTeorico.resize(800, 600);
-    graficoTeorico.show();
+    enVivo.iniciar([&] {
+        ejecutarBenchmarks(tamanos, tiemposMejor, tiemposPeor, tiemposPromedio, enVivo.publicador());
+        if (enVivo.cancelada()) return;
+        contarOperacionesPorCaso(tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+        compararNucleosMezcla(tamanos);
+        compararRutaConteo(tamanos);
+        if (nParcial > 0) resultadosParciales = compararOrdenamientoParcial(nParcial);
+    }, [&] {
+        // Modelo de complejidad que mejor explica los tiempos medidos
+        imprimirAjuste(cout, "mejor caso", ajustarComplejidad(tamanos, tiemposMejor));
+        imprimirAjuste(cout, "peor caso", ajustarComplejidad(tamanos, tiemposPeor));
+        imprimirAjuste(cout, "caso promedio", ajustarComplejidad(tamanos, tiemposPromedio));
+
+        graficoResultados.clearPlottables();
+        graficarResultados(&graficoResultados, tamanos, tiemposMejor, tiemposPeor, tiemposPromedio);
+
+        // Gráfica de operaciones contadas (comparaciones, intercambios, ...)
+        graficarOperacionesContadas(&graficoOperaciones, tamanos, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+        graficoOperaciones.resize(800, 600);
+        graficoOperaciones.show();
+
+        // Gráfica de contadores de hardware del caso promedio (solo si el sistema los permite)
+        if (graficarContadores(&graficoContadores, tamanos, tiemposPromedio)) {
+            graficoContadores.resize(800, 600);
+            graficoContadores.show();
+        }
+
+        // Gráfica de memoria por elemento de los tres casos (reservas, bytes, picos y fallos de página)
+        if (graficarMemoria(&graficoMemoria, tamanos, {{"Mejor Caso", Qt::blue, tiemposMejor}, {"Peor Caso", Qt::red, tiemposPeor}, {"Caso Promedio", Qt::darkGreen, tiemposPromedio}})) {
+            graficoMemoria.resize(800, 600);
+            graficoMemoria.show();
+        }
+
+        if (!resultadosParciales.empty()) {
+            graficarParcial(&graficoParcial, resultadosParciales);
+            graficoParcial.resize(800, 600);
+            graficoParcial.show();
+        }
+    });
 
     return app.exec();
 }
-
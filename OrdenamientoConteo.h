@@ -0,0 +1,189 @@
+#ifndef ORDENAMIENTOCONTEO_H
+#define ORDENAMIENTOCONTEO_H
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Ordenamientos.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Ruta rápida para claves enteras densas: una pasada SIMD detecta el rango [mínimo, máximo]
+// y, si rango/n es pequeño, se ordena por conteo o por cubetas en O(n + rango) en lugar de
+// O(n log n). Los generadores del proyecto producen permutaciones de 0..n-1 o 1..n, que
+// son exactamente este caso.
+
+// Estrategia elegida por ordenarEnteros
+enum class EstrategiaEnteros {
+    Conteo,   // rango <= factorConteo * n
+    Cubetas,  // rango <= factorCubetas * n
+    Mezcla    // Rango disperso: ordenamiento por comparación
+};
+
+inline const char* nombreEstrategia(EstrategiaEnteros estrategia) {
+    switch (estrategia) {
+        case EstrategiaEnteros::Conteo: return "Conteo";
+        case EstrategiaEnteros::Cubetas: return "Cubetas";
+        default: return "Merge Sort";
+    }
+}
+
+struct RangoClaves {
+    int minimo;
+    int maximo;
+};
+
+#if defined(__SSE2__) && !defined(__SSE4_1__)
+// SSE2 no tiene pminsd/pmaxsd: se emulan con comparación y máscara
+static inline __m128i minimoSse2(__m128i a, __m128i b) {
+    __m128i mascara = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mascara, b), _mm_andnot_si128(mascara, a));
+}
+
+static inline __m128i maximoSse2(__m128i a, __m128i b) {
+    __m128i mascara = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mascara, a), _mm_andnot_si128(mascara, b));
+}
+#endif
+
+// Mínimo y máximo en una sola pasada (n > 0)
+inline RangoClaves detectarRango(const int* datos, size_t n) {
+    size_t i = 0;
+    int minimo = INT_MAX, maximo = INT_MIN;
+
+#if defined(__AVX2__)
+    if (n >= 8) {
+        __m256i vMin = _mm256_set1_epi32(INT_MAX), vMax = _mm256_set1_epi32(INT_MIN);
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + i));
+            vMin = _mm256_min_epi32(vMin, v);
+            vMax = _mm256_max_epi32(vMax, v);
+        }
+        alignas(32) int menores[8], mayores[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(menores), vMin);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mayores), vMax);
+        for (int c = 0; c < 8; c++) {
+            minimo = std::min(minimo, menores[c]);
+            maximo = std::max(maximo, mayores[c]);
+        }
+    }
+#elif defined(__SSE2__)
+    if (n >= 4) {
+        __m128i vMin = _mm_set1_epi32(INT_MAX), vMax = _mm_set1_epi32(INT_MIN);
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+#if defined(__SSE4_1__)
+            vMin = _mm_min_epi32(vMin, v);
+            vMax = _mm_max_epi32(vMax, v);
+#else
+            vMin = minimoSse2(vMin, v);
+            vMax = maximoSse2(vMax, v);
+#endif
+        }
+        alignas(16) int menores[4], mayores[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(menores), vMin);
+        _mm_store_si128(reinterpret_cast<__m128i*>(mayores), vMax);
+        for (int c = 0; c < 4; c++) {
+            minimo = std::min(minimo, menores[c]);
+            maximo = std::max(maximo, mayores[c]);
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        minimo = std::min(minimo, datos[i]);
+        maximo = std::max(maximo, datos[i]);
+    }
+    return {minimo, maximo};
+}
+
+// Ordenamiento por conteo: histograma de tamaño rango y reescritura en orden
+inline void ordenarPorConteo(std::vector<int>& datos, RangoClaves rango) {
+    std::vector<uint32_t> conteos(static_cast<size_t>(static_cast<int64_t>(rango.maximo) - rango.minimo + 1), 0);
+    for (int v : datos) {
+        conteos[static_cast<size_t>(static_cast<int64_t>(v) - rango.minimo)]++;
+    }
+
+    size_t k = 0;
+    for (size_t c = 0; c < conteos.size(); c++) {
+        int valor = static_cast<int>(rango.minimo + static_cast<int64_t>(c));
+        for (uint32_t r = 0; r < conteos[c]; r++) {
+            datos[k++] = valor;
+        }
+    }
+}
+
+// Ordenamiento por cubetas: n cubetas de igual ancho repartidas por conteo (sin listas),
+// cada cubeta queda con O(rango/n) elementos esperados y se termina con inserción. Con
+// claves agrupadas una cubeta puede recibir casi todo: las que pasan de limiteInsercion se
+// terminan con Merge Sort para no caer en O(n²)
+inline void ordenarPorCubetas(std::vector<int>& datos, RangoClaves rango) {
+    size_t n = datos.size();
+    uint64_t ancho = static_cast<uint64_t>(static_cast<int64_t>(rango.maximo) - rango.minimo) + 1;
+    auto cubetaDe = [&](int v) {
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<int64_t>(v) - rango.minimo) * n) / ancho);
+    };
+
+    std::vector<uint32_t> inicios(n + 1, 0);
+    for (int v : datos) {
+        inicios[cubetaDe(v) + 1]++;
+    }
+    for (size_t c = 0; c < n; c++) {
+        inicios[c + 1] += inicios[c];
+    }
+
+    std::vector<int> repartidos(n);
+    std::vector<uint32_t> posiciones(inicios.begin(), inicios.end() - 1);
+    for (int v : datos) {
+        repartidos[posiciones[cubetaDe(v)]++] = v;
+    }
+
+    constexpr uint32_t limiteInsercion = 32;
+    for (size_t c = 0; c < n; c++) {
+        if (inicios[c + 1] - inicios[c] > limiteInsercion) {
+            ordenarPorMezcla(repartidos.begin() + inicios[c], repartidos.begin() + inicios[c + 1]);
+            continue;
+        }
+        for (uint32_t i = inicios[c] + 1; i < inicios[c + 1]; i++) {
+            int valor = repartidos[i];
+            uint32_t j = i;
+            for (; j > inicios[c] && repartidos[j - 1] > valor; j--) {
+                repartidos[j] = repartidos[j - 1];
+            }
+            repartidos[j] = valor;
+        }
+    }
+    datos = std::move(repartidos);
+}
+
+// Decide la estrategia a partir del rango detectado
+inline EstrategiaEnteros elegirEstrategia(RangoClaves rango, size_t n) {
+    constexpr uint64_t factorConteo = 4;
+    constexpr uint64_t factorCubetas = 64;
+    uint64_t ancho = static_cast<uint64_t>(static_cast<int64_t>(rango.maximo) - rango.minimo) + 1;
+    if (ancho <= factorConteo * n) return EstrategiaEnteros::Conteo;
+    if (ancho <= factorCubetas * n) return EstrategiaEnteros::Cubetas;
+    return EstrategiaEnteros::Mezcla;
+}
+
+// Ordena enteros usando la ruta rápida cuando las claves son densas; devuelve la estrategia usada
+inline EstrategiaEnteros ordenarEnteros(std::vector<int>& datos) {
+    if (datos.size() < 2) return EstrategiaEnteros::Mezcla;
+
+    RangoClaves rango = detectarRango(datos.data(), datos.size());
+    EstrategiaEnteros estrategia = elegirEstrategia(rango, datos.size());
+    switch (estrategia) {
+        case EstrategiaEnteros::Conteo: ordenarPorConteo(datos, rango); break;
+        case EstrategiaEnteros::Cubetas: ordenarPorCubetas(datos, rango); break;
+        default: ordenarPorMezcla(datos); break;
+    }
+    return estrategia;
+}
+
+#endif // ORDENAMIENTOCONTEO_H
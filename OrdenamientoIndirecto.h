@@ -0,0 +1,79 @@
+#ifndef ORDENAMIENTOINDIRECTO_H
+#define ORDENAMIENTOINDIRECTO_H
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <numeric> // Para std::iota
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "Ordenamientos.h"
+
+// Ordenamiento indirecto sobre Merge Sort: en lugar de mover registros grandes en cada pasada
+// de mezcla, se ordena una permutación de índices de 32 bits (o pares clave/índice empaquetados
+// en 64 bits) y la permutación se aplica al final en una sola pasada de recolección.
+
+// Ordena los índices 0..n-1 según la clave proyectada de cada elemento (argsort estable)
+template <std::ranges::random_access_range R, class Comp = std::ranges::less, class Proj = std::identity>
+std::vector<uint32_t> argsortPorMezcla(const R& datos, Comp comp = {}, Proj proj = {}, NucleoMezcla nucleo = NucleoMezcla::Clasico) {
+    std::vector<uint32_t> indices(std::ranges::size(datos));
+    std::iota(indices.begin(), indices.end(), 0u);
+
+    auto primero = std::ranges::begin(datos);
+    auto claveDeIndice = [&](uint32_t indice) -> decltype(auto) { return std::invoke(proj, primero[indice]); };
+    ordenarPorMezcla(indices, comp, claveDeIndice, nucleo);
+    return indices;
+}
+
+// Convierte una clave entera de hasta 32 bits a un orden sin signo equivalente
+template <std::integral K>
+    requires (sizeof(K) <= sizeof(uint32_t))
+inline uint32_t claveSinSigno(K clave) {
+    if constexpr (std::is_signed_v<K>) {
+        return static_cast<uint32_t>(static_cast<int32_t>(clave)) ^ 0x80000000u;
+    } else {
+        return static_cast<uint32_t>(clave);
+    }
+}
+
+// Modo clave/carga: cada elemento se representa por (clave << 32 | índice) y se ordenan enteros
+// de 64 bits, que caben en registros y permiten la mezcla sin saltos. El índice en los bits bajos
+// desempata por posición original, así que el resultado también es estable.
+template <std::ranges::random_access_range R, class Proj = std::identity>
+    requires std::integral<std::remove_cvref_t<std::invoke_result_t<Proj&, std::ranges::range_reference_t<const R>>>>
+std::vector<uint32_t> argsortPorPares(const R& datos, Proj proj = {}, NucleoMezcla nucleo = NucleoMezcla::SinSaltos) {
+    auto n = std::ranges::size(datos);
+    auto primero = std::ranges::begin(datos);
+
+    std::vector<uint64_t> pares(n);
+    for (size_t i = 0; i < n; i++) {
+        pares[i] = (static_cast<uint64_t>(claveSinSigno(std::invoke(proj, primero[i]))) << 32) | static_cast<uint32_t>(i);
+    }
+    ordenarPorMezcla(pares, nucleo);
+
+    std::vector<uint32_t> indices(n);
+    for (size_t i = 0; i < n; i++) {
+        indices[i] = static_cast<uint32_t>(pares[i]);
+    }
+    return indices;
+}
+
+// Aplica la permutación en una sola pasada: lecturas aleatorias (con prefetch) y escrituras secuenciales
+template <class T>
+void aplicarPermutacion(std::vector<T>& datos, const std::vector<uint32_t>& indices) {
+    constexpr size_t distanciaPrefetch = 8;
+    std::vector<T> resultado;
+    resultado.reserve(datos.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+#if defined(__GNUC__)
+        if (i + distanciaPrefetch < indices.size()) {
+            __builtin_prefetch(&datos[indices[i + distanciaPrefetch]]);
+        }
+#endif
+        resultado.push_back(std::move(datos[indices[i]]));
+    }
+    datos = std::move(resultado);
+}
+
+#endif // ORDENAMIENTOINDIRECTO_H
@@ -0,0 +1,201 @@
+#ifndef ORDENAMIENTOPARCIAL_H
+#define ORDENAMIENTOPARCIAL_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+#include "Ordenamientos.h"
+
+// Ordenamiento parcial: deja en [primero, medio) los k = medio - primero menores elementos,
+// ordenados, como std::partial_sort. El resto del rango queda en orden no especificado.
+
+// Montículo acotado: O(n log k), conveniente cuando k es pequeño
+template <std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenarParcialMonticulo(It primero, It medio, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (primero == medio) return;
+    std::ranges::make_heap(primero, medio, comp, proj);
+    for (It it = medio; it != ultimo; ++it) {
+        // La raíz del montículo es el mayor de los k candidatos actuales
+        if (std::invoke(comp, std::invoke(proj, *it), std::invoke(proj, *primero))) {
+            std::ranges::pop_heap(primero, medio, comp, proj);
+            std::ranges::iter_swap(medio - 1, it);
+            std::ranges::push_heap(primero, medio, comp, proj);
+        }
+    }
+    std::ranges::sort_heap(primero, medio, comp, proj);
+}
+
+// Introselect: quickselect con mediana de tres y partición de Hoare. Si la recursión se
+// degenera (más de 2 log2(n) particiones) se termina con el montículo acotado.
+// Al terminar, *enesimo es el elemento que ocuparía esa posición en el rango ordenado.
+template <std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void introseleccion(It primero, It enesimo, It ultimo, Comp comp = {}, Proj proj = {}) {
+    auto menor = [&](const auto& a, const auto& b) {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    };
+    if (enesimo >= ultimo) return;
+
+    int profundidad = 2 * static_cast<int>(std::log2(static_cast<double>(ultimo - primero) + 1));
+    while (ultimo - primero > 16) {
+        if (profundidad-- == 0) {
+            ordenarParcialMonticulo(primero, enesimo + 1, ultimo, comp, proj);
+            return;
+        }
+
+        // Mediana de tres: primero <= medio <= último
+        It medio = primero + (ultimo - primero - 1) / 2;
+        It fin = ultimo - 1;
+        if (menor(*medio, *primero)) std::ranges::iter_swap(medio, primero);
+        if (menor(*fin, *medio)) {
+            std::ranges::iter_swap(fin, medio);
+            if (menor(*medio, *primero)) std::ranges::iter_swap(medio, primero);
+        }
+        std::iter_value_t<It> pivote = *medio;
+
+        // Partición de Hoare: [primero, j] <= pivote <= [j + 1, ultimo)
+        std::ptrdiff_t i = -1, j = ultimo - primero;
+        while (true) {
+            do { i++; } while (menor(primero[i], pivote));
+            do { j--; } while (menor(pivote, primero[j]));
+            if (i >= j) break;
+            std::ranges::iter_swap(primero + i, primero + j);
+        }
+
+        if (enesimo - primero <= j) {
+            ultimo = primero + j + 1;
+        } else {
+            primero = primero + j + 1;
+        }
+    }
+
+    // Tramo corto: inserción directa
+    for (It i = primero + 1; i < ultimo; ++i) {
+        for (It j = i; j > primero && menor(*j, *(j - 1)); --j) {
+            std::ranges::iter_swap(j, j - 1);
+        }
+    }
+}
+
+// Introselect seguido de Merge Sort sobre los k menores: O(n + k log k), conveniente cuando k es grande
+template <std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenarParcialSeleccion(It primero, It medio, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (primero == medio) return;
+    introseleccion(primero, medio - 1, ultimo, comp, proj);
+    ordenarPorMezcla(primero, medio - 1, comp, proj);
+}
+
+// Elige la estrategia según k/n. Umbral: en las medianas de compararOrdenamientoParcial
+// (MergeSort --parcial n) el montículo y introselect se cruzan cerca de k/n = 1% tanto con
+// n = 10^5 como con n = 10^6
+template <std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenarParcial(It primero, It medio, It ultimo, Comp comp = {}, Proj proj = {}) {
+    auto k = medio - primero;
+    auto n = ultimo - primero;
+    if (k * 100 <= n) {
+        ordenarParcialMonticulo(primero, medio, ultimo, comp, proj);
+    } else {
+        ordenarParcialSeleccion(primero, medio, ultimo, comp, proj);
+    }
+}
+
+template <std::ranges::random_access_range R, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+void ordenarParcial(R&& datos, std::ptrdiff_t k, Comp comp = {}, Proj proj = {}) {
+    auto primero = std::ranges::begin(datos);
+    auto ultimo = std::ranges::end(datos);
+    ordenarParcial(primero, primero + std::min<std::ptrdiff_t>(k, ultimo - primero), ultimo, std::move(comp), std::move(proj));
+}
+
+// Top-k en flujo: consume la entrada por bloques sin materializarla completa y conserva
+// solo los k menores vistos hasta el momento. Para k pequeño mantiene un montículo acotado;
+// para k grande acumula hasta 2k candidatos y los poda con introselect (O(1) amortizado por
+// elemento), descartando de entrada lo que no supera al k-ésimo de la última poda.
+template <class T, class Comp = std::ranges::less, class Proj = std::identity>
+class TopKEnFlujo {
+public:
+    explicit TopKEnFlujo(size_t k, Comp comp = {}, Proj proj = {})
+        : k(k), usarMonticulo(k <= umbralMonticulo), comp(std::move(comp)), proj(std::move(proj)) {
+        candidatos.reserve(usarMonticulo ? k : 2 * k);
+    }
+
+    template <std::input_iterator It>
+    void consumir(It primero, It ultimo) {
+        if (k == 0) return;
+        for (; primero != ultimo; ++primero) {
+            if (usarMonticulo) {
+                agregarAlMonticulo(*primero);
+            } else {
+                agregarAlBuffer(*primero);
+            }
+        }
+    }
+
+    template <std::ranges::input_range R>
+    void consumir(const R& bloque) {
+        consumir(std::ranges::begin(bloque), std::ranges::end(bloque));
+    }
+
+    // Los k menores vistos (o todos, si hubo menos de k), ordenados
+    std::vector<T> resultado() const {
+        std::vector<T> menores = candidatos;
+        if (usarMonticulo) {
+            if (menores.size() == k) {
+                std::ranges::sort_heap(menores, comp, proj);
+            } else {
+                ordenarPorMezcla(menores, comp, proj);
+            }
+        } else {
+            ordenarParcial(menores, static_cast<std::ptrdiff_t>(k), comp, proj);
+            if (menores.size() > k) menores.resize(k);
+        }
+        return menores;
+    }
+
+private:
+    static constexpr size_t umbralMonticulo = 4096;
+
+    bool menor(const T& a, const T& b) {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    }
+
+    void agregarAlMonticulo(const T& valor) {
+        if (candidatos.size() < k) {
+            candidatos.push_back(valor);
+            if (candidatos.size() == k) std::ranges::make_heap(candidatos, comp, proj);
+        } else if (menor(valor, candidatos.front())) {
+            std::ranges::pop_heap(candidatos, comp, proj);
+            candidatos.back() = valor;
+            std::ranges::push_heap(candidatos, comp, proj);
+        }
+    }
+
+    void agregarAlBuffer(const T& valor) {
+        if (hayUmbral && !menor(valor, umbral)) return;
+        candidatos.push_back(valor);
+        if (candidatos.size() == 2 * k) {
+            introseleccion(candidatos.begin(), candidatos.begin() + (k - 1), candidatos.end(), comp, proj);
+            candidatos.resize(k);
+            umbral = candidatos[k - 1];
+            hayUmbral = true;
+        }
+    }
+
+    size_t k;
+    bool usarMonticulo;
+    Comp comp;
+    Proj proj;
+    std::vector<T> candidatos;
+    T umbral{};
+    bool hayUmbral = false;
+};
+
+#endif // ORDENAMIENTOPARCIAL_H
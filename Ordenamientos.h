@@ -0,0 +1,209 @@
+#ifndef ORDENAMIENTOS_H
+#define ORDENAMIENTOS_H
+
+#include <algorithm>
+#include <functional> // Para std::invoke, std::identity y std::ranges::less
+#include <iterator>   // Para los conceptos de iteradores (std::sortable)
+#include <memory>     // Para std::addressof
+#include <ranges>
+#include <utility>
+#include <vector>
+#include "PoliticaConteo.h"
+
+// Algoritmos de ordenamiento genéricos (C++20) sobre iteradores o rangos, con comparador y
+// proyección al estilo de std::ranges::sort. Ejemplo: ordenarPorMezcla(registros, {}, &Registro::clave)
+// El primer parámetro de plantilla es la política de conteo (ConteoNulo salvo que se indique):
+// ordenarBurbuja<ConteoOperaciones>(datos) cuenta comparaciones e intercambios.
+
+// Núcleos de mezcla disponibles para Merge Sort
+enum class NucleoMezcla {
+    Clasico,       // Con un if por elemento (el salto falla ~50% con datos aleatorios)
+    SinSaltos,     // Selección por aritmética de índices, desenrollado x4
+    Bidireccional  // Sin saltos, mezclando desde ambos extremos a la vez
+};
+
+inline const char* nombreNucleo(NucleoMezcla nucleo) {
+    switch (nucleo) {
+        case NucleoMezcla::SinSaltos: return "Sin saltos";
+        case NucleoMezcla::Bidireccional: return "Bidireccional";
+        default: return "Clasico";
+    }
+}
+
+// Implementación genérica del algoritmo de ordenamiento Burbuja
+template <class Politica = ConteoNulo, std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenarBurbuja(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    auto longitud = ultimo - primero;
+    for (decltype(longitud) i = 0; i < longitud - 1; i++) {
+        bool huboIntercambio = false;
+        for (It j = primero; j < ultimo - i - 1; ++j) {
+            Politica::comparacion();
+            if (std::invoke(comp, std::invoke(proj, *(j + 1)), std::invoke(proj, *j))) {
+                Politica::intercambio();
+                std::ranges::iter_swap(j, j + 1);
+                huboIntercambio = true;
+            }
+        }
+        if (!huboIntercambio) break; // Si no se hicieron intercambios, los datos ya están ordenados
+    }
+}
+
+template <class Politica = ConteoNulo, std::ranges::random_access_range R, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+void ordenarBurbuja(R&& datos, Comp comp = {}, Proj proj = {}) {
+    ordenarBurbuja<Politica>(std::ranges::begin(datos), std::ranges::end(datos), std::move(comp), std::move(proj));
+}
+
+// Algoritmo genérico de ordenamiento SelectionSort
+template <class Politica = ConteoNulo, std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenamientoPorSeleccion(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    for (It i = primero; i < ultimo; ++i) {
+        It indiceMin = i;
+        for (It j = i + 1; j < ultimo; ++j) {
+            Politica::comparacion();
+            if (std::invoke(comp, std::invoke(proj, *j), std::invoke(proj, *indiceMin))) {
+                indiceMin = j;
+            }
+        }
+        if (indiceMin != i) {
+            Politica::intercambio();
+            std::ranges::iter_swap(i, indiceMin);
+        }
+    }
+}
+
+template <class Politica = ConteoNulo, std::ranges::random_access_range R, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+void ordenamientoPorSeleccion(R&& datos, Comp comp = {}, Proj proj = {}) {
+    ordenamientoPorSeleccion<Politica>(std::ranges::begin(datos), std::ranges::end(datos), std::move(comp), std::move(proj));
+}
+
+// Mezcla clásica: [izq, izq + tamIzq) y [der, der + tamDer) ya están ordenados y se mueven a destino
+template <class Politica, class T, class It, class Comp, class Proj>
+void mezclarClasico(T* izq, std::ptrdiff_t tamIzq, T* der, std::ptrdiff_t tamDer, It destino, Comp& comp, Proj& proj) {
+    std::ptrdiff_t i = 0, j = 0;
+    while (i < tamIzq && j < tamDer) {
+        Politica::comparacion();
+        if (!std::invoke(comp, std::invoke(proj, der[j]), std::invoke(proj, izq[i]))) {
+            *destino = std::move(izq[i]);
+            i++;
+        } else {
+            *destino = std::move(der[j]);
+            j++;
+        }
+        ++destino;
+    }
+    destino = std::move(izq + i, izq + tamIzq, destino);
+    std::move(der + j, der + tamDer, destino);
+}
+
+// Un paso de mezcla sin saltos: se elige la dirección de origen (cmov) en lugar de saltar
+template <class Politica, class T, class It, class Comp, class Proj>
+inline void pasoSinSaltos(T* izq, T* der, std::ptrdiff_t& i, std::ptrdiff_t& j, It destino, Comp& comp, Proj& proj) {
+    Politica::comparacion();
+    bool tomarDer = std::invoke(comp, std::invoke(proj, der[j]), std::invoke(proj, izq[i]));
+    T* origen = tomarDer ? der + j : izq + i;
+    *destino = std::move(*origen);
+    j += tomarDer;
+    i += !tomarDer;
+}
+
+// Mezcla sin saltos: cada paso avanza exactamente uno de los índices, por lo que
+// mientras queden 4 elementos en ambos lados se pueden hacer 4 pasos sin revisar límites
+template <class Politica, class T, class It, class Comp, class Proj>
+void mezclarSinSaltos(T* izq, std::ptrdiff_t tamIzq, T* der, std::ptrdiff_t tamDer, It destino, Comp& comp, Proj& proj) {
+    std::ptrdiff_t i = 0, j = 0;
+    while (i + 4 <= tamIzq && j + 4 <= tamDer) {
+        pasoSinSaltos<Politica>(izq, der, i, j, destino, comp, proj);
+        pasoSinSaltos<Politica>(izq, der, i, j, destino + 1, comp, proj);
+        pasoSinSaltos<Politica>(izq, der, i, j, destino + 2, comp, proj);
+        pasoSinSaltos<Politica>(izq, der, i, j, destino + 3, comp, proj);
+        destino += 4;
+    }
+    while (i < tamIzq && j < tamDer) {
+        pasoSinSaltos<Politica>(izq, der, i, j, destino, comp, proj);
+        ++destino;
+    }
+    destino = std::move(izq + i, izq + tamIzq, destino);
+    std::move(der + j, der + tamDer, destino);
+}
+
+// Mezcla bidireccional: el frente toma el menor y el final toma el mayor en cada vuelta,
+// dos cadenas de dependencia independientes que el procesador ejecuta en paralelo.
+// Mientras ambos lados tengan elementos, frente y final nunca toman el mismo elemento.
+template <class Politica, class T, class It, class Comp, class Proj>
+void mezclarBidireccional(T* izq, std::ptrdiff_t tamIzq, T* der, std::ptrdiff_t tamDer, It destino, Comp& comp, Proj& proj) {
+    std::ptrdiff_t i = 0, j = 0, k = 0;                                        // Frente
+    std::ptrdiff_t iFin = tamIzq - 1, jFin = tamDer - 1, kFin = tamIzq + tamDer - 1; // Final
+
+    while (i <= iFin && j <= jFin) {
+        Politica::comparacion();
+        Politica::comparacion();
+        bool frenteDer = std::invoke(comp, std::invoke(proj, der[j]), std::invoke(proj, izq[i]));
+        T* origenFrente = frenteDer ? der + j : izq + i;
+
+        // En empate sale la derecha por el final (estable)
+        bool finalIzq = std::invoke(comp, std::invoke(proj, der[jFin]), std::invoke(proj, izq[iFin]));
+        T* origenFinal = finalIzq ? izq + iFin : der + jFin;
+
+        destino[k++] = std::move(*origenFrente);
+        destino[kFin--] = std::move(*origenFinal);
+
+        j += frenteDer;
+        i += !frenteDer;
+        iFin -= finalIzq;
+        jFin -= !finalIzq;
+    }
+
+    // Solo puede quedar un tramo contiguo de uno de los lados
+    for (; i <= iFin; i++) destino[k++] = std::move(izq[i]);
+    for (; j <= jFin; j++) destino[k++] = std::move(der[j]);
+}
+
+// Paso recursivo de Merge Sort; el buffer se reutiliza en todas las mezclas
+template <class Politica, class It, class T, class Comp, class Proj>
+void ordenarPorMezclaRecursivo(It primero, It ultimo, std::vector<T>& buffer, Comp& comp, Proj& proj, NucleoMezcla nucleo) {
+    auto n = ultimo - primero;
+    if (n < 2) return;
+
+    It medio = primero + n / 2;
+    ordenarPorMezclaRecursivo<Politica>(primero, medio, buffer, comp, proj, nucleo);
+    ordenarPorMezclaRecursivo<Politica>(medio, ultimo, buffer, comp, proj, nucleo);
+
+    // Ambas mitades se mueven al buffer (como subIzq/subDer) y se mezclan de vuelta
+    buffer.assign(std::make_move_iterator(primero), std::make_move_iterator(ultimo));
+    Politica::movimiento(2 * n); // Al buffer y de vuelta al rango
+    T* izq = buffer.data();
+    T* der = buffer.data() + n / 2;
+    switch (nucleo) {
+        case NucleoMezcla::SinSaltos: mezclarSinSaltos<Politica>(izq, n / 2, der, n - n / 2, primero, comp, proj); break;
+        case NucleoMezcla::Bidireccional: mezclarBidireccional<Politica>(izq, n / 2, der, n - n / 2, primero, comp, proj); break;
+        default: mezclarClasico<Politica>(izq, n / 2, der, n - n / 2, primero, comp, proj); break;
+    }
+}
+
+// Implementación genérica de Merge Sort (estable)
+template <class Politica = ConteoNulo, std::random_access_iterator It, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+void ordenarPorMezcla(It primero, It ultimo, Comp comp = {}, Proj proj = {}, NucleoMezcla nucleo = NucleoMezcla::Clasico) {
+    std::vector<std::iter_value_t<It>> buffer;
+    buffer.reserve(ultimo - primero);
+    Politica::asignacion();
+    ordenarPorMezclaRecursivo<Politica>(primero, ultimo, buffer, comp, proj, nucleo);
+}
+
+template <class Politica = ConteoNulo, std::ranges::random_access_range R, class Comp = std::ranges::less, class Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+void ordenarPorMezcla(R&& datos, Comp comp = {}, Proj proj = {}, NucleoMezcla nucleo = NucleoMezcla::Clasico) {
+    ordenarPorMezcla<Politica>(std::ranges::begin(datos), std::ranges::end(datos), std::move(comp), std::move(proj), nucleo);
+}
+
+template <class Politica = ConteoNulo, std::ranges::random_access_range R>
+    requires std::sortable<std::ranges::iterator_t<R>>
+void ordenarPorMezcla(R&& datos, NucleoMezcla nucleo) {
+    ordenarPorMezcla<Politica>(std::ranges::begin(datos), std::ranges::end(datos), std::ranges::less{}, std::identity{}, nucleo);
+}
+
+#endif // ORDENAMIENTOS_H
@@ -0,0 +1,281 @@
+#ifndef PAGINASMEMORIA_H
+#define PAGINASMEMORIA_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "MedicionMemoria.h" // ganchosMemoriaInstalados
+
+#if defined(__unix__)
+#include <sys/mman.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Arena de páginas para las reservas de la región medida: mientras una arena está en uso en un
+// hilo (UsarArena), los operator new de GanchosMemoria.h reservan de ella, así las entradas
+// (copias de vectores), los búferes de Merge Sort y los nodos del BST y de la lista quedan en
+// páginas del tipo pedido sin cambiar los tipos de los algoritmos:
+//  - sistema: sin arena, malloc (y el kernel decide si usa páginas grandes),
+//  - 4k: páginas de 4 KiB, con MADV_NOHUGEPAGE aunque THP esté en "always",
+//  - 2m: páginas de 2 MiB; del fondo de hugetlbfs (MAP_HUGETLB, vm.nr_hugepages) si hay
+//    páginas reservadas, si no THP con MADV_HUGEPAGE en tramos alineados a 2 MiB (el kernel
+//    puede negarlas si no hay memoria contigua o THP está en "never").
+// La arena reparte bloques por clase de tamaño (múltiplos de 16 hasta 256 bytes, potencias de
+// dos después) con una lista de libres por clase; los bloques de hasta 1 MiB salen de tramos
+// de 32 MiB y los mayores tienen su propia región. Nada se devuelve al sistema hasta destruir
+// la arena: todo lo reservado en ella tiene que liberarse (o abandonarse) antes. Un bloque
+// liberado desde otro hilo no vuelve a las listas (la arena no usa candados).
+
+enum class TipoPaginas { Sistema, Normales, Grandes, NumTipos };
+
+inline const char* nombreTipoPaginas(TipoPaginas tipo) {
+    static const char* nombres[static_cast<int>(TipoPaginas::NumTipos)] = {"sistema", "4k", "2m"};
+    return nombres[static_cast<int>(tipo)];
+}
+
+inline bool leerTipoPaginas(const std::string& nombre, TipoPaginas& tipo) {
+    for (int t = 0; t < static_cast<int>(TipoPaginas::NumTipos); t++) {
+        if (nombre == nombreTipoPaginas(static_cast<TipoPaginas>(t))) {
+            tipo = static_cast<TipoPaginas>(t);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline constexpr size_t bytesPaginaGrande = 2 << 20;
+
+struct RegionPaginas {
+    void* inicio = nullptr;
+    size_t bytes = 0;
+    bool hugetlb = false; // Del fondo de hugetlbfs (si no, mmap anónimo o malloc)
+    bool mapeada = true;
+};
+
+// Región de al menos bytes (redondeados a 2 MiB) respaldada con el tipo de página pedido
+inline RegionPaginas mapearPaginas(size_t bytes, TipoPaginas tipo) {
+    RegionPaginas region;
+    region.bytes = (bytes + bytesPaginaGrande - 1) / bytesPaginaGrande * bytesPaginaGrande;
+#if defined(__linux__)
+    const int proteccion = PROT_READ | PROT_WRITE;
+    if (tipo == TipoPaginas::Grandes) {
+#ifdef MAP_HUGETLB
+        int banderas = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_2MB
+        banderas |= MAP_HUGE_2MB;
+#endif
+        void* enorme = mmap(nullptr, region.bytes, proteccion, banderas, -1, 0);
+        if (enorme != MAP_FAILED) {
+            region.inicio = enorme;
+            region.hugetlb = true;
+            return region;
+        }
+#endif
+        // THP solo usa páginas de 2 MiB en tramos alineados: se pide de más y se recorta
+        void* memoria = mmap(nullptr, region.bytes + bytesPaginaGrande, proteccion, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memoria != MAP_FAILED) {
+            uintptr_t inicio = reinterpret_cast<uintptr_t>(memoria);
+            uintptr_t alineado = (inicio + bytesPaginaGrande - 1) & ~static_cast<uintptr_t>(bytesPaginaGrande - 1);
+            if (alineado > inicio) munmap(memoria, alineado - inicio);
+            munmap(reinterpret_cast<void*>(alineado + region.bytes), inicio + bytesPaginaGrande - alineado);
+            region.inicio = reinterpret_cast<void*>(alineado);
+#ifdef MADV_HUGEPAGE
+            madvise(region.inicio, region.bytes, MADV_HUGEPAGE);
+#endif
+            return region;
+        }
+    } else {
+        void* memoria = mmap(nullptr, region.bytes, proteccion, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memoria != MAP_FAILED) {
+            region.inicio = memoria;
+#ifdef MADV_NOHUGEPAGE
+            madvise(region.inicio, region.bytes, MADV_NOHUGEPAGE);
+#endif
+            return region;
+        }
+    }
+#else
+    (void)tipo;
+#endif
+    region.inicio = std::malloc(region.bytes);
+    region.mapeada = false;
+    return region;
+}
+
+inline void desmapearPaginas(const RegionPaginas& region) {
+#if defined(__unix__)
+    if (region.mapeada) {
+        munmap(region.inicio, region.bytes);
+        return;
+    }
+#endif
+    std::free(region.inicio);
+}
+
+class ArenaPaginas {
+public:
+    explicit ArenaPaginas(TipoPaginas tipo) : tipoPaginas(tipo), hilo(std::this_thread::get_id()) {}
+
+    ArenaPaginas(const ArenaPaginas&) = delete;
+    ArenaPaginas& operator=(const ArenaPaginas&) = delete;
+
+    ~ArenaPaginas() {
+        while (regiones) {
+            RegionPaginas region = regiones->region;
+            regiones = regiones->siguiente;
+            desmapearPaginas(region);
+        }
+    }
+
+    TipoPaginas tipo() const { return tipoPaginas; }
+    bool activa() const { return tipoPaginas != TipoPaginas::Sistema; }
+
+    // Bytes que ocupa en la arena un bloque pedido de bytes (el tamaño de su clase)
+    static size_t bytesOcupados(size_t bytes) { return bytesClase(claseBloque(bytes)); }
+
+    // Bloque de al menos bytes, alineado a 16; nullptr si no se pudo mapear
+    void* reservar(size_t bytes) {
+        int clase = claseBloque(bytes);
+        if (libres[clase]) {
+            BloqueLibre* bloque = libres[clase];
+            libres[clase] = bloque->siguiente;
+            return bloque;
+        }
+        size_t tamano = bytesClase(clase);
+        if (tamano > bytesBloqueMaximoTramo) return nuevaRegion(tamano);
+        if (restante < tamano) {
+            // El tramo con su encabezado ocupa justo bytesTramo
+            cursor = static_cast<char*>(nuevaRegion(bytesTramo - sizeof(EncabezadoRegion)));
+            if (!cursor) return nullptr;
+            restante = bytesTramo - sizeof(EncabezadoRegion);
+        }
+        void* bloque = cursor;
+        cursor += tamano;
+        restante -= tamano;
+        return bloque;
+    }
+
+    // bytes es lo que se pidió a reservar
+    void liberar(void* bloque, size_t bytes) {
+        if (std::this_thread::get_id() != hilo) return;
+        int clase = claseBloque(bytes);
+        libres[clase] = new (bloque) BloqueLibre{libres[clase]};
+    }
+
+private:
+    struct BloqueLibre {
+        BloqueLibre* siguiente;
+    };
+    // Al principio de cada región, para desmapearlas todas al final
+    struct alignas(64) EncabezadoRegion {
+        EncabezadoRegion* siguiente;
+        RegionPaginas region;
+    };
+
+    static constexpr size_t bytesTramo = 32 << 20;
+    static constexpr size_t bytesBloqueMaximoTramo = 1 << 20;
+    static constexpr int numClases = 64;
+
+    static int claseBloque(size_t bytes) {
+        if (bytes <= 256) return bytes == 0 ? 0 : static_cast<int>((bytes + 15) / 16 - 1);
+        return 16 + static_cast<int>(std::bit_width(bytes - 1)) - 9;
+    }
+    static size_t bytesClase(int clase) { return clase < 16 ? static_cast<size_t>(clase + 1) * 16 : size_t(512) << (clase - 16); }
+
+    void* nuevaRegion(size_t bytes) {
+        RegionPaginas region = mapearPaginas(sizeof(EncabezadoRegion) + bytes, tipoPaginas);
+        if (!region.inicio) return nullptr;
+        regiones = new (region.inicio) EncabezadoRegion{regiones, region};
+        return regiones + 1;
+    }
+
+    TipoPaginas tipoPaginas;
+    std::thread::id hilo;
+    BloqueLibre* libres[numClases] = {};
+    char* cursor = nullptr;
+    size_t restante = 0;
+    EncabezadoRegion* regiones = nullptr;
+};
+
+// Arena en uso en el hilo; la leen los ganchos de GanchosMemoria.h
+inline thread_local ArenaPaginas* arenaPaginasHilo = nullptr;
+
+// Pone una arena en uso en el hilo mientras exista (nullptr o una arena "sistema": malloc)
+class UsarArena {
+public:
+    explicit UsarArena(ArenaPaginas* arena) : anterior(arenaPaginasHilo) { arenaPaginasHilo = arena && arena->activa() ? arena : nullptr; }
+    explicit UsarArena(ArenaPaginas& arena) : UsarArena(&arena) {}
+    UsarArena(const UsarArena&) = delete;
+    UsarArena& operator=(const UsarArena&) = delete;
+    ~UsarArena() { arenaPaginasHilo = anterior; }
+
+private:
+    ArenaPaginas* anterior;
+};
+
+// Bytes que ocupa de verdad una reserva de operator new de bytes, para estimar el conjunto de
+// trabajo de las estructuras de nodos: el prefijo de GanchosMemoria.h (prefijoGancho sin
+// alineación extendida) si está instalado, más el redondeo de la clase de la arena o del
+// fragmento de malloc. Un nodo de lista de 24 bytes ocupa 48
+inline size_t bytesOcupadosReserva(size_t bytes, TipoPaginas paginas) {
+    size_t pedidos = bytes + (ganchosMemoriaInstalados ? alignof(std::max_align_t) : 0);
+    if (paginas != TipoPaginas::Sistema && ganchosMemoriaInstalados) return ArenaPaginas::bytesOcupados(pedidos);
+#if defined(__GLIBC__)
+    void* prueba = std::malloc(pedidos);
+    size_t ocupados = malloc_usable_size(prueba) + sizeof(size_t); // Más el encabezado del fragmento
+    std::free(prueba);
+    return ocupados;
+#else
+    return (pedidos + 15) / 16 * 16;
+#endif
+}
+
+// Bytes en páginas grandes (THP o hugetlbfs) del mapeo de /proc/self/smaps que contiene la
+// dirección; -1 si no se pudo leer
+inline long long bytesPaginasGrandesEn(const void* direccion) {
+    std::ifstream smaps("/proc/self/smaps");
+    if (!smaps) return -1;
+    uintptr_t buscada = reinterpret_cast<uintptr_t>(direccion);
+    bool dentro = false;
+    long long bytes = 0;
+    std::string linea;
+    while (std::getline(smaps, linea)) {
+        std::istringstream campos(linea);
+        std::string primero;
+        campos >> primero;
+        size_t guion = primero.find('-');
+        if (guion != std::string::npos && primero.back() != ':') {
+            // Encabezado de un mapeo: "inicio-fin permisos ..."
+            if (dentro) return bytes;
+            uintptr_t inicio = std::stoull(primero.substr(0, guion), nullptr, 16);
+            uintptr_t fin = std::stoull(primero.substr(guion + 1), nullptr, 16);
+            dentro = buscada >= inicio && buscada < fin;
+        } else if (dentro && (primero == "AnonHugePages:" || primero == "Private_Hugetlb:" || primero == "Shared_Hugetlb:")) {
+            long long kib = 0;
+            campos >> kib;
+            bytes += kib * 1024;
+        }
+    }
+    return dentro ? bytes : -1;
+}
+
+// Qué respalda de verdad una arena "2m" en este sistema: mapea y toca 4 MiB y lo consulta en
+// /proc/self/smaps ("hugetlb", "thp" o "ninguna", p. ej. con THP en "never")
+inline const char* paginasGrandesDisponibles() {
+    RegionPaginas region = mapearPaginas(2 * bytesPaginaGrande, TipoPaginas::Grandes);
+    if (!region.inicio) return "ninguna";
+    for (size_t i = 0; i < region.bytes; i += 4096) static_cast<volatile char*>(region.inicio)[i] = 1;
+    const char* resultado = region.hugetlb ? "hugetlb" : bytesPaginasGrandesEn(region.inicio) > 0 ? "thp" : "ninguna";
+    desmapearPaginas(region);
+    return resultado;
+}
+
+#endif // PAGINASMEMORIA_H
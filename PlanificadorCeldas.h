@@ -0,0 +1,195 @@
+#ifndef PLANIFICADORCELDAS_H
+#define PLANIFICADORCELDAS_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Planificador de celdas independientes (algoritmo, tamaño, caso) en paralelo: un hilo por
+// núcleo, fijado a ese núcleo, que toma celdas de una cola común. Opcionalmente usa un solo
+// hilo lógico por núcleo físico (sin hermanos SMT) y limita cuántas celdas pesadas en memoria
+// corren a la vez, para que compitan lo menos posible por caché y ancho de banda.
+
+struct ConfiguracionPlanificador {
+    int hilos = 0;                // 0: uno por núcleo elegido
+    bool evitarHermanosSMT = true;
+    int maximoPesadas = 1;        // Celdas pesadas en memoria que pueden correr al mismo tiempo
+};
+
+struct TareaCelda {
+    std::function<void(int nucleo)> ejecutar; // Recibe la CPU donde corre (-1 si no se fijó)
+    double costoEstimado = 0;                 // Las más costosas se reparten primero
+    bool pesadaMemoria = false;
+};
+
+// CPUs que el proceso puede usar
+inline std::vector<int> cpusPermitidas() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    if (sched_getaffinity(0, sizeof(conjunto), &conjunto) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &conjunto)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); cpu++) cpus.push_back(static_cast<int>(cpu));
+    }
+    return cpus;
+}
+
+// Identificador del núcleo físico de una CPU lógica (paquete y core_id de sysfs); sin sysfs
+// cada CPU lógica cuenta como un núcleo
+inline std::pair<int, int> nucleoFisico(int cpu) {
+    std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+    int paquete = -1, nucleo = -1;
+    std::ifstream(base + "physical_package_id") >> paquete;
+    std::ifstream(base + "core_id") >> nucleo;
+    if (nucleo < 0) return {-1, cpu};
+    return {paquete, nucleo};
+}
+
+// CPUs donde correrán los hilos: todas, o la primera CPU lógica de cada núcleo físico
+inline std::vector<int> elegirNucleos(bool evitarHermanosSMT) {
+    std::vector<int> cpus = cpusPermitidas();
+    if (!evitarHermanosSMT) return cpus;
+    std::vector<int> elegidas;
+    std::set<std::pair<int, int>> vistos;
+    for (int cpu : cpus) {
+        if (vistos.insert(nucleoFisico(cpu)).second) elegidas.push_back(cpu);
+    }
+    return elegidas;
+}
+
+// Fija el hilo actual a una CPU; devuelve la CPU donde quedó corriendo o -1
+inline int fijarHiloACpu(int cpu) {
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(conjunto), &conjunto) != 0) return -1;
+    return sched_getcpu();
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+// Limita el hilo actual a un conjunto de CPUs (los hilos que cree después lo heredan)
+inline bool fijarHiloACpus(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    for (int cpu : cpus) CPU_SET(cpu, &conjunto);
+    return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(conjunto), &conjunto) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+// CPUs aisladas del planificador del kernel (isolcpus=, lista "2-5,7" en sysfs); vacía si no hay
+inline std::vector<int> cpusAisladas() {
+    std::vector<int> cpus;
+    std::string lista;
+    std::ifstream("/sys/devices/system/cpu/isolated") >> lista;
+    std::stringstream flujo(lista);
+    std::string rango;
+    while (std::getline(flujo, rango, ',')) {
+        int desde = -1, hasta = -1;
+        char guion = 0;
+        std::stringstream partes(rango);
+        if (!(partes >> desde)) continue;
+        if (!(partes >> guion >> hasta)) hasta = desde;
+        for (int cpu = desde; cpu <= hasta; cpu++) cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+class PlanificadorCeldas {
+public:
+    explicit PlanificadorCeldas(const ConfiguracionPlanificador& configuracion = {}) : configuracion(configuracion) {
+        nucleos = elegirNucleos(configuracion.evitarHermanosSMT);
+        if (configuracion.hilos > 0 && configuracion.hilos < static_cast<int>(nucleos.size())) nucleos.resize(configuracion.hilos);
+    }
+
+    // Se puede llamar también desde una celda en ejecución (por ejemplo, para encadenar el
+    // siguiente tamaño de una serie); la cola se mantiene ordenada por costo descendente
+    void agregar(TareaCelda tarea) {
+        {
+            std::lock_guard<std::mutex> candado(mutex);
+            auto posicion = std::upper_bound(pendientes.begin(), pendientes.end(), tarea.costoEstimado,
+                                             [](double costo, const TareaCelda& t) { return costo > t.costoEstimado; });
+            pendientes.insert(posicion, std::move(tarea));
+        }
+        cambio.notify_one();
+    }
+
+    const std::vector<int>& nucleosElegidos() const { return nucleos; }
+
+    // Ejecuta todas las celdas agregadas y regresa cuando terminan
+    void ejecutar() {
+        std::vector<std::thread> hilos;
+        for (int cpu : nucleos) {
+            hilos.emplace_back([this, cpu] { trabajar(cpu); });
+        }
+        for (std::thread& hilo : hilos) hilo.join();
+        pendientes.clear();
+    }
+
+private:
+    void trabajar(int cpu) {
+        int nucleo = fijarHiloACpu(cpu);
+        while (true) {
+            TareaCelda tarea;
+            {
+                std::unique_lock<std::mutex> candado(mutex);
+                auto siguiente = pendientes.end();
+                cambio.wait(candado, [&] {
+                    siguiente = std::find_if(pendientes.begin(), pendientes.end(), [&](const TareaCelda& t) {
+                        return !t.pesadaMemoria || pesadasCorriendo < std::max(1, configuracion.maximoPesadas);
+                    });
+                    return (pendientes.empty() && enEjecucion == 0) || siguiente != pendientes.end();
+                });
+                if (siguiente == pendientes.end()) return; // No queda nada ni puede llegar nada
+                tarea = std::move(*siguiente);
+                pendientes.erase(siguiente);
+                enEjecucion++;
+                if (tarea.pesadaMemoria) pesadasCorriendo++;
+            }
+
+            tarea.ejecutar(nucleo);
+
+            {
+                std::lock_guard<std::mutex> candado(mutex);
+                enEjecucion--;
+                if (tarea.pesadaMemoria) pesadasCorriendo--;
+            }
+            cambio.notify_all();
+        }
+    }
+
+    ConfiguracionPlanificador configuracion;
+    std::vector<int> nucleos;
+    std::vector<TareaCelda> pendientes;
+    std::mutex mutex;
+    std::condition_variable cambio;
+    int pesadasCorriendo = 0;
+    int enEjecucion = 0;
+};
+
+#endif // PLANIFICADORCELDAS_H
@@ -0,0 +1,77 @@
+#ifndef POLITICACONTEO_H
+#define POLITICACONTEO_H
+
+#include <cstddef>
+#include <ostream>
+
+// Política de conteo de operaciones elegida en tiempo de compilación. Los algoritmos reciben
+// la política como primer parámetro de plantilla (ordenarBurbuja<ConteoOperaciones>(datos)):
+//  - ConteoNulo (por defecto): todas las llamadas son funciones vacías inline, así que la
+//    instanciación que se cronometra no contiene ningún contador.
+//  - ConteoOperaciones: instanciación aparte, usada en una pasada sin cronómetro, que cuenta
+//    comparaciones, intercambios, movimientos, visitas a nodos y asignaciones de memoria.
+
+struct Operaciones {
+    long long comparaciones = 0;
+    long long intercambios = 0;
+    long long movimientos = 0;
+    long long visitas = 0;
+    long long asignaciones = 0;
+
+    static constexpr int numMetricas = 5;
+
+    long long metrica(int indice) const {
+        const long long valores[numMetricas] = {comparaciones, intercambios, movimientos, visitas, asignaciones};
+        return valores[indice];
+    }
+
+    static const char* nombreMetrica(int indice) {
+        static const char* nombres[numMetricas] = {"comparaciones", "intercambios", "movimientos", "visitas", "asignaciones"};
+        return nombres[indice];
+    }
+};
+
+// Una línea por celda con las métricas que no quedaron en cero
+inline void imprimirOperaciones(std::ostream& salida, const char* caso, int n, const Operaciones& operaciones) {
+    salida << caso << "\tn=" << n;
+    for (int m = 0; m < Operaciones::numMetricas; m++) {
+        if (operaciones.metrica(m) != 0) salida << "\t" << Operaciones::nombreMetrica(m) << "=" << operaciones.metrica(m);
+    }
+    salida << std::endl;
+}
+
+struct ConteoNulo {
+    static constexpr bool activo = false;
+
+    static void comparacion() {}
+    static void intercambio() {}
+    static void movimiento(size_t = 1) {}
+    static void visita() {}
+    static void asignacion() {}
+};
+
+struct ConteoOperaciones {
+    static constexpr bool activo = true;
+
+    // Un contador por hilo, para que las pasadas de conteo puedan correr en paralelo
+    static inline thread_local Operaciones actual;
+
+    static void comparacion() { actual.comparaciones++; }
+    static void intercambio() { actual.intercambios++; }
+    static void movimiento(size_t cantidad = 1) { actual.movimientos += static_cast<long long>(cantidad); }
+    static void visita() { actual.visitas++; }
+    static void asignacion() { actual.asignaciones++; }
+
+    static void reiniciar() { actual = Operaciones{}; }
+    static Operaciones leer() { return actual; }
+};
+
+// Ejecuta la operación con los contadores en cero y devuelve lo que contó
+template <class Operacion>
+Operaciones contarOperaciones(Operacion&& operacion) {
+    ConteoOperaciones::reiniciar();
+    operacion();
+    return ConteoOperaciones::leer();
+}
+
+#endif // POLITICACONTEO_H
@@ -24,6 +24,7 @@
 ****************************************************************************/
 
 #include "qcustomplot.h"
+#include "Trazas.h" // Zonas de traza del proyecto (vacías sin TRAZAS_ACTIVAS)
 
 
 /* including file 'src/vector2d.cpp'       */
@@ -1146,6 +1147,7 @@ void QCPLayer::draw(QCPPainter *painter)
   {
     if (child->realVisibility())
     {
+      ZONA_TRAZA(child->metaObject()->className()); // Un evento por plottable, eje, leyenda, ...
       painter->save();
       painter->setClipRect(child->clipRect().translated(0, -1));
       child->applyDefaultAntialiasingHint(painter);
@@ -1165,6 +1167,7 @@ void QCPLayer::draw(QCPPainter *painter)
 */
 void QCPLayer::drawToPaintBuffer()
 {
+  ZONA_TRAZA("QCPLayer::drawToPaintBuffer");
   if (QSharedPointer<QCPAbstractPaintBuffer> pb = mPaintBuffer.toStrongRef())
   {
     if (QCPPainter *painter = pb->startPainting())
@@ -15129,6 +15132,7 @@ void QCustomPlot::replot(QCustomPlot::RefreshPriority refreshPriority)
   
   if (mReplotting) // incase signals loop back to replot slot
     return;
+  ZONA_TRAZA("QCustomPlot::replot");
   mReplotting = true;
   mReplotQueued = false;
   emit beforeReplot();
@@ -15770,6 +15774,7 @@ void QCustomPlot::draw(QCPPainter *painter)
 */
 void QCustomPlot::updateLayout()
 {
+  ZONA_TRAZA("QCustomPlot::updateLayout");
   // run through layout phases:
   mPlotLayout->update(QCPLayoutElement::upPreparation);
   mPlotLayout->update(QCPLayoutElement::upMargins);
@@ -0,0 +1,178 @@
+#ifndef REGISTROALGORITMOS_H
+#define REGISTROALGORITMOS_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Ordenamientos.h"   // Burbuja, selección y Merge Sort
+#include "ArbolBusqueda.h"   // Inserción en BST
+#include "ListaOrdenada.h"   // Búsqueda en lista ordenada
+#include "ArnesBenchmark.h"  // Arnés de repeticiones
+#include "CacheEntradas.h"   // Entradas pregeneradas y mapeadas
+#include "HuellaCodigo.h"    // Dirección del código de cada caso
+
+// Registro de los algoritmos que se pueden medir, compartido por la consola
+// (BenchmarkConsola.cpp) y el comparador gráfico (CompararAlgoritmos.cpp). El registro es un
+// arreglo constexpr: agregar un algoritmo es agregar una entrada, y los nombres repetidos se
+// detectan al compilar. Cada algoritmo define sus casos; la semilla de cada celda depende solo
+// de n y del índice del caso, así que los ordenamientos reciben entradas idénticas.
+
+// Costo relativo de una celda para repartir primero las más largas
+inline double costoCuadratico(int n) { return static_cast<double>(n) * n; }
+inline double costoLinearitmico(int n) { return n * std::log2(std::max(n, 2)); }
+inline double costoLineal(int n) { return n; }
+
+// Un caso de un algoritmo: cómo medir la celda (n, semilla) y cuánto cuesta y ocupa
+struct DefinicionCaso {
+    std::string caso;
+    std::function<EstadisticasCelda(int n, unsigned semilla, const ConfiguracionArnes&)> medir;
+    double (*costo)(int);
+    size_t bytesPorElemento;
+    const void* codigo;    // Función medida, para la huella de la caché de resultados
+    const void* generador; // Función que arma la entrada, que también entra en esa huella
+};
+
+struct DefinicionAlgoritmo {
+    std::string algoritmo;
+    std::vector<DefinicionCaso> casos;
+};
+
+// Casos de un ordenamiento, uno por distribución de entrada (salvo aleatoria64, que no cabe en
+// int). Cada celda obtiene su entrada en el hilo que la mide: mapeada de la caché si hay
+// directorio, o generada con hilosGeneracion hilos; cada repetición ordena una copia y la
+// primera se verifica.
+inline DefinicionAlgoritmo definirOrdenamiento(const std::string& algoritmo, void (*ordenar)(std::vector<int>&), double (*costoMejor)(int),
+                                               double (*costo)(int), size_t bytesPorElemento, const std::string& directorioCache, int hilosGeneracion) {
+    DefinicionAlgoritmo definicion{algoritmo, {}};
+    for (int d = 0; d < numDistribuciones; d++) {
+        Distribucion distribucion = static_cast<Distribucion>(d);
+        if (distribucion == Distribucion::Aleatoria64) continue;
+        definicion.casos.push_back({nombreDistribucion(distribucion),
+                                    [ordenar, distribucion, directorioCache, hilosGeneracion](int n, unsigned semilla, const ConfiguracionArnes& arnes) {
+                                        EntradaMapeada<int> entrada = obtenerEntrada<int>(directorioCache, distribucion, n, semilla, {}, hilosGeneracion);
+                                        return medirCeldaVerificada([&] { return entrada.copia(); }, ordenar,
+                                                                    [](const std::vector<int>& datos) { return std::is_sorted(datos.begin(), datos.end()); }, arnes);
+                                    },
+                                    distribucion == Distribucion::Ordenada ? costoMejor : costo, bytesPorElemento, direccionCodigo(ordenar),
+                                    direccionCodigo(&generarEntrada<int>)});
+    }
+    return definicion;
+}
+
+// Inserción de los valores 0..n-1 en un BST recién generado (igual que BinarySearch.cpp).
+// paginas: la arena de las celdas, que decide cuánto ocupa cada nodo
+inline DefinicionAlgoritmo definirBST(TipoPaginas paginas) {
+    const struct { const char* caso; Nodo* (*generar)(int, unsigned); double (*costo)(int); } casos[] = {
+        {"mejor", [](int n, unsigned semilla) { return generarBSTBalanceado(n, semilla); }, costoLinearitmico},
+        {"peor", [](int n, unsigned) { return generarBSTPeorCaso(n); }, costoCuadratico},
+        {"promedio", [](int n, unsigned semilla) { return generarBSTCasoPromedio(n, semilla); }, costoLinearitmico}};
+
+    DefinicionAlgoritmo definicion{"bst", {}};
+    for (const auto& caso : casos) {
+        auto generar = caso.generar;
+        definicion.casos.push_back({caso.caso,
+                                    [generar](int n, unsigned semilla, const ConfiguracionArnes& arnes) {
+                                        return medirCelda([&] { return ArbolBST(generar(n, semilla)); },
+                                                          [&](ArbolBST& arbol) {
+                                                              for (int i = 0; i < n; ++i) {
+                                                                  insertar(arbol.raiz, i);
+                                                              }
+                                                          },
+                                                          arnes);
+                                    },
+                                    caso.costo, 2 * bytesOcupadosReserva(sizeof(Nodo), paginas), direccionCodigo(&insertar<ConteoNulo>),
+                                    direccionCodigo(generar)});
+    }
+    return definicion;
+}
+
+// Búsqueda en lista ordenada con los mismos valores que SortedLinkedList.cpp
+inline DefinicionAlgoritmo definirLista(TipoPaginas paginas) {
+    const struct { const char* caso; std::list<int> (*generar)(int, unsigned); int (*valor)(int); } casos[] = {
+        {"mejor", [](int n, unsigned) { return generarListaOrdenada(n); }, [](int) { return 0; }},
+        {"peor", [](int n, unsigned) { return generarListaPeorCaso(n); }, [](int n) { return n; }},
+        {"promedio", [](int n, unsigned semilla) { return generarListaCasoPromedio(n, semilla); }, [](int n) { return n / 2; }}};
+
+    DefinicionAlgoritmo definicion{"lista", {}};
+    for (const auto& caso : casos) {
+        auto generar = caso.generar;
+        auto valorBuscado = caso.valor;
+        definicion.casos.push_back({caso.caso,
+                                    [generar, valorBuscado](int n, unsigned semilla, const ConfiguracionArnes& arnes) {
+                                        // La lista no la arma preparar(): sus nodos van a una arena propia
+                                        ArenaPaginas arena(arnes.paginas);
+                                        std::list<int> lista;
+                                        {
+                                            ZONA_TRAZA("generar");
+                                            UsarArena usar(arena);
+                                            lista = generar(n, semilla);
+                                        }
+                                        int valor = valorBuscado(n);
+                                        return medirCelda([&]() -> const std::list<int>& { return lista; },
+                                                          [&](const std::list<int>& datos) { evitarOptimizacion(buscarEnListaOrdenada(datos, valor)); },
+                                                          arnes);
+                                    },
+                                    costoLineal, bytesOcupadosReserva(3 * sizeof(void*), paginas), direccionCodigo(&buscarEnListaOrdenada<ConteoNulo>),
+                                    direccionCodigo(generar)});
+    }
+    return definicion;
+}
+
+// Entrada del registro: nombre para --algoritmos, complejidad del caso promedio (para las
+// leyendas) y la función que arma sus casos para las páginas del arnés
+struct EntradaRegistro {
+    const char* nombre;
+    const char* complejidad;
+    DefinicionAlgoritmo (*definir)(const std::string& directorioCache, int hilosGeneracion, TipoPaginas paginas);
+};
+
+inline constexpr EntradaRegistro registroAlgoritmos[] = {
+    {"burbuja", "O(n^2)", [](const std::string& cache, int hilos, TipoPaginas) {
+         return definirOrdenamiento("burbuja", [](std::vector<int>& datos) { ordenarBurbuja(datos); }, costoLineal, costoCuadratico, sizeof(int), cache, hilos);
+     }},
+    {"seleccion", "O(n^2)", [](const std::string& cache, int hilos, TipoPaginas) {
+         return definirOrdenamiento("seleccion", [](std::vector<int>& datos) { ordenamientoPorSeleccion(datos); }, costoCuadratico, costoCuadratico, sizeof(int), cache, hilos);
+     }},
+    {"mezcla", "O(n log n)", [](const std::string& cache, int hilos, TipoPaginas) {
+         return definirOrdenamiento("mezcla", [](std::vector<int>& datos) { ordenarPorMezcla(datos); }, costoLinearitmico, costoLinearitmico, 2 * sizeof(int), cache, hilos);
+     }},
+    {"bst", "O(n log n)", [](const std::string&, int, TipoPaginas paginas) { return definirBST(paginas); }},
+    {"lista", "O(n)", [](const std::string&, int, TipoPaginas paginas) { return definirLista(paginas); }},
+};
+
+constexpr bool nombresRegistroUnicos() {
+    for (const EntradaRegistro& a : registroAlgoritmos) {
+        int apariciones = 0;
+        for (const EntradaRegistro& b : registroAlgoritmos) apariciones += std::string_view(a.nombre) == b.nombre;
+        if (apariciones != 1) return false;
+    }
+    return true;
+}
+static_assert(nombresRegistroUnicos(), "Nombre de algoritmo repetido en registroAlgoritmos");
+
+// Entrada con ese nombre, o nullptr
+inline const EntradaRegistro* buscarEnRegistro(const std::string& nombre) {
+    for (const EntradaRegistro& entrada : registroAlgoritmos) {
+        if (nombre == entrada.nombre) return &entrada;
+    }
+    return nullptr;
+}
+
+// Lista de nombres separada por comas, para los mensajes de uso
+inline std::string nombresRegistro() {
+    std::string nombres;
+    for (const EntradaRegistro& entrada : registroAlgoritmos) nombres += (nombres.empty() ? "" : ",") + std::string(entrada.nombre);
+    return nombres;
+}
+
+inline std::vector<DefinicionAlgoritmo> definirAlgoritmos(const std::string& directorioCache, int hilosGeneracion, TipoPaginas paginas) {
+    std::vector<DefinicionAlgoritmo> algoritmos;
+    for (const EntradaRegistro& entrada : registroAlgoritmos) algoritmos.push_back(entrada.definir(directorioCache, hilosGeneracion, paginas));
+    return algoritmos;
+}
+
+#endif // REGISTROALGORITMOS_H
@@ -0,0 +1,172 @@
+#ifndef RELOJCICLOS_H
+#define RELOJCICLOS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RELOJ_CICLOS_X86 1
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+// Reloj de alta resolución para el arnés. En x86 con TSC invariante (frecuencia constante y
+// que sigue contando en los estados de reposo) lee el contador de ciclos de forma serializada:
+// lfence + rdtsc al empezar y rdtscp + lfence al terminar, para que la región medida no se
+// mezcle con las instrucciones de alrededor. Los ciclos se convierten a nanosegundos con una
+// calibración contra CLOCK_MONOTONIC_RAW. Sin TSC invariante se usa CLOCK_MONOTONIC_RAW (o
+// steady_clock fuera de Linux). También mide el sobrecosto de una lectura inicio/fin para
+// descontarlo de cada muestra.
+
+class RelojCiclos {
+public:
+    RelojCiclos() {
+        tsc = tscInvariante();
+        if (tsc) calibrar();
+        medirSobrecosto();
+    }
+
+    RelojCiclos(const RelojCiclos&) = delete;
+    RelojCiclos& operator=(const RelojCiclos&) = delete;
+
+    bool usaTsc() const { return tsc; }
+
+    // Marcas de inicio y fin de una región (en ciclos o en ns según el respaldo)
+    uint64_t inicio() const {
+#ifdef RELOJ_CICLOS_X86
+        if (tsc) {
+            _mm_lfence();
+            uint64_t marca = __rdtsc();
+            _mm_lfence();
+            return marca;
+        }
+#endif
+        return relojRespaldoNs();
+    }
+
+    uint64_t fin() const {
+#ifdef RELOJ_CICLOS_X86
+        if (tsc) {
+            unsigned procesador;
+            uint64_t marca = __rdtscp(&procesador);
+            _mm_lfence();
+            return marca;
+        }
+#endif
+        return relojRespaldoNs();
+    }
+
+    // Lectura sin serializar, para las marcas de traza: importa más el costo que el orden exacto
+    uint64_t marcaRapida() const {
+#ifdef RELOJ_CICLOS_X86
+        if (tsc) return __rdtsc();
+#endif
+        return relojRespaldoNs();
+    }
+
+    double aNs(uint64_t marcas) const { return marcas * nsPorMarca; }
+
+    // Duración de la región sin el sobrecosto de las lecturas (nunca negativa)
+    double duracionNs(uint64_t desde, uint64_t hasta) const { return std::max(0.0, aNs(hasta - desde) - sobrecosto); }
+
+    // Tiempo actual en ns con el mismo reloj, para reemplazar a high_resolution_clock
+    long long ahoraNs() const { return static_cast<long long>(aNs(inicio())); }
+
+    double sobrecostoNs() const { return sobrecosto; }
+    double resolucionNs() const { return resolucion; }
+
+    std::string describir() const {
+        std::ostringstream texto;
+        if (tsc) texto << "TSC invariante a " << 1 / nsPorMarca << " GHz";
+        else texto << "CLOCK_MONOTONIC_RAW";
+        texto << ", resolución " << resolucion << " ns, sobrecosto " << sobrecosto << " ns por medición";
+        return texto.str();
+    }
+
+private:
+    static uint64_t relojRespaldoNs() {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_RAW)
+        timespec ahora;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ahora);
+        return static_cast<uint64_t>(ahora.tv_sec) * 1000000000ULL + ahora.tv_nsec;
+#else
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // cpuid 0x80000007, EDX bit 8: TSC invariante; 0x80000001, EDX bit 27: rdtscp
+    static bool tscInvariante() {
+#ifdef RELOJ_CICLOS_X86
+        unsigned a, b, c, d;
+        if (!__get_cpuid(0x80000007, &a, &b, &c, &d) || !(d & (1u << 8))) return false;
+        if (!__get_cpuid(0x80000001, &a, &b, &c, &d) || !(d & (1u << 27))) return false;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Ciclos contra CLOCK_MONOTONIC_RAW en varias ventanas de unos 10 ms; se toma la mediana
+    void calibrar() {
+        std::vector<double> relaciones;
+        for (int ventana = 0; ventana < 5; ventana++) {
+            uint64_t nsInicio = relojRespaldoNs(), ciclosInicio = inicio();
+            uint64_t nsFin;
+            do nsFin = relojRespaldoNs(); while (nsFin - nsInicio < 10000000);
+            uint64_t ciclosFin = fin();
+            if (ciclosFin > ciclosInicio) relaciones.push_back(static_cast<double>(nsFin - nsInicio) / (ciclosFin - ciclosInicio));
+        }
+        if (relaciones.empty()) {
+            tsc = false;
+            return;
+        }
+        std::nth_element(relaciones.begin(), relaciones.begin() + relaciones.size() / 2, relaciones.end());
+        nsPorMarca = relaciones[relaciones.size() / 2];
+    }
+
+    // Mediana de muchas mediciones vacías; la resolución es el menor paso distinto de cero
+    void medirSobrecosto() {
+        const int mediciones = 2000;
+        std::vector<double> vacias;
+        vacias.reserve(mediciones);
+        double paso = 0;
+        for (int i = 0; i < mediciones; i++) {
+            uint64_t desde = inicio();
+            uint64_t hasta = fin();
+            double ns = aNs(hasta - desde);
+            vacias.push_back(ns);
+            if (ns > 0 && (paso == 0 || ns < paso)) paso = ns;
+        }
+        std::nth_element(vacias.begin(), vacias.begin() + mediciones / 2, vacias.end());
+        sobrecosto = vacias[mediciones / 2];
+        resolucion = tsc ? nsPorMarca : paso;
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_RAW)
+        if (!tsc) {
+            timespec granularidad;
+            if (clock_getres(CLOCK_MONOTONIC_RAW, &granularidad) == 0) resolucion = std::max(resolucion, granularidad.tv_nsec + 1e9 * granularidad.tv_sec);
+        }
+#endif
+    }
+
+    bool tsc = false;
+    double nsPorMarca = 1; // Sin TSC las marcas ya son ns
+    double sobrecosto = 0;
+    double resolucion = 1;
+};
+
+// Reloj compartido; se calibra la primera vez que se usa (unos 50 ms)
+inline RelojCiclos& relojCiclos() {
+    static RelojCiclos reloj;
+    return reloj;
+}
+
+#endif // RELOJCICLOS_H
@@ -0,0 +1,109 @@
+#ifndef SALIDARESULTADOS_H
+#define SALIDARESULTADOS_H
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include "ArnesBenchmark.h"
+
+// Salida de resultados para trabajos automáticos: una línea por repetición con algoritmo,
+// caso, n, número de repetición, nanosegundos por operación, operaciones del lote, CPU donde
+// corrió, contadores de hardware y métricas de memoria de esa repetición. Es seguro escribir
+// desde varios hilos (las celdas llegan en el orden en que terminan).
+//  - CSV: encabezado fijo; los contadores y métricas no disponibles quedan vacíos.
+//  - Líneas JSON: un objeto por línea; los contadores y métricas no disponibles se omiten.
+
+enum class FormatoSalida {
+    Csv,
+    JsonLineas
+};
+
+class EscritorResultados {
+public:
+    EscritorResultados(std::ostream& salida, FormatoSalida formato) : salida(salida), formato(formato) {}
+
+    void escribirEncabezado() {
+        if (formato != FormatoSalida::Csv) return;
+        salida << "algoritmo,caso,n,repeticion,ns,lote,nucleo";
+        for (int e = 0; e < NumEventosContador; e++) salida << "," << claveEvento(e);
+        for (int m = 0; m < NumMetricasMemoria; m++) salida << "," << claveMetricaMemoria(m);
+        salida << "\n";
+        salida.flush();
+    }
+
+    // Escribe todas las repeticiones de la celda y vacía el flujo, para que un trabajo que se
+    // interrumpa conserve las celdas ya medidas
+    void escribirCelda(const std::string& algoritmo, const std::string& caso, int n, const EstadisticasCelda& celda) {
+        std::lock_guard<std::mutex> candado(mutex);
+        for (size_t r = 0; r < celda.muestras.size(); r++) {
+            LecturaContadores lectura = r < celda.lecturas.size() ? celda.lecturas[r] : LecturaContadores();
+            LecturaMemoria memoria = r < celda.lecturasMemoria.size() ? celda.lecturasMemoria[r] : LecturaMemoria();
+            if (formato == FormatoSalida::Csv) {
+                escribirCsv(algoritmo, caso, n, r, celda.muestras[r], celda.lote, celda.nucleo, lectura, memoria);
+            } else {
+                escribirJson(algoritmo, caso, n, r, celda.muestras[r], celda.lote, celda.nucleo, lectura, memoria);
+            }
+        }
+        salida.flush();
+    }
+
+private:
+    void escribirCsv(const std::string& algoritmo, const std::string& caso, int n, size_t repeticion, double ns, long long lote, int nucleo, const LecturaContadores& lectura,
+                     const LecturaMemoria& memoria) {
+        salida << algoritmo << "," << caso << "," << n << "," << repeticion << ",";
+        escribirNs(ns, lote);
+        salida << "," << lote << "," << nucleo;
+        for (int e = 0; e < NumEventosContador; e++) {
+            salida << ",";
+            if (lectura.disponible(e)) salida << lectura.valores[e];
+        }
+        for (int m = 0; m < NumMetricasMemoria; m++) {
+            salida << ",";
+            if (memoria.disponible(m)) salida << memoria.valores[m];
+        }
+        salida << "\n";
+    }
+
+    void escribirJson(const std::string& algoritmo, const std::string& caso, int n, size_t repeticion, double ns, long long lote, int nucleo, const LecturaContadores& lectura,
+                      const LecturaMemoria& memoria) {
+        salida << "{\"algoritmo\":\"" << escaparJson(algoritmo) << "\",\"caso\":\"" << escaparJson(caso) << "\",\"n\":" << n
+               << ",\"repeticion\":" << repeticion << ",\"ns\":";
+        escribirNs(ns, lote);
+        salida << ",\"lote\":" << lote << ",\"nucleo\":" << nucleo << ",\"contadores\":{";
+        bool primero = true;
+        for (int e = 0; e < NumEventosContador; e++) {
+            if (!lectura.disponible(e)) continue;
+            salida << (primero ? "" : ",") << "\"" << claveEvento(e) << "\":" << lectura.valores[e];
+            primero = false;
+        }
+        salida << "},\"memoria\":{";
+        primero = true;
+        for (int m = 0; m < NumMetricasMemoria; m++) {
+            if (!memoria.disponible(m)) continue;
+            salida << (primero ? "" : ",") << "\"" << claveMetricaMemoria(m) << "\":" << memoria.valores[m];
+            primero = false;
+        }
+        salida << "}}\n";
+    }
+
+    // Nanosegundos enteros; con lotes, la muestra es un promedio y puede ser menor que 1 ns
+    void escribirNs(double ns, long long lote) {
+        if (lote > 1) salida << ns;
+        else salida << static_cast<long long>(ns);
+    }
+
+    static std::string escaparJson(const std::string& texto) {
+        std::string escapado;
+        for (char c : texto) {
+            if (c == '"' || c == '\\') escapado += '\\';
+            escapado += c;
+        }
+        return escapado;
+    }
+
+    std::ostream& salida;
+    FormatoSalida formato;
+    std::mutex mutex;
+};
+
+#endif // SALIDARESULTADOS_H
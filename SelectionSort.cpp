@@ -4,100 +4,76 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <algorithm> // Para std::shuffle
-#include <random>    // Para std::random_device y std::mt19937
 #include <cmath>     // Para funciones matemáticas
+#include "Ordenamientos.h" // Algoritmos de ordenamiento genéricos
+#include "GraficasArnes.h"  // Arnés de repeticiones y barras de dispersión
+#include "GraficaEnVivo.h"  // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "ConfiguracionBarrido.h" // Tamaños desde --barrido / --tamanos
+#include "GeneradoresEntrada.h"   // Entradas reproducibles de cada caso
+#include "TuberiaEntradas.h"      // Entradas generadas en otro núcleo durante la medición
 
 using namespace std;
 using namespace std::chrono;
 
-// Función para obtener el tiempo del sistema en nanosegundos
-long long obtenerTiempoSistemaNano() {
-    return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
-}
+// Función para realizar pruebas de rendimiento
+// Cada celda se repite con el arnés; la copia de la entrada se hace fuera de la medición
+// Cada celda se publica para la gráfica en vivo en cuanto se mide; si se cerró la ventana se deja de medir
+void ejecutarPruebas(const vector<int>& tamanios, vector<EstadisticasCelda>& tiemposMejorCaso, vector<EstadisticasCelda>& tiemposPeorCaso, vector<EstadisticasCelda>& tiemposPromedio, const PublicarCelda& publicar) {
+    ConfiguracionArnes configuracion;
+    auto ordenar = [](vector<int>& datos) { ordenamientoPorSeleccion(datos); };
 
-// Algoritmo de ordenamiento SelectionSort
-void ordenamientoPorSeleccion(vector<int>& arr) {
-    int n = arr.size();
-    for (int i = 0; i < n - 1; i++) {
-        int indiceMin = i;
-        for (int j = i + 1; j < n; j++) {
-            if (arr[j] < arr[indiceMin]) {
-                indiceMin = j;
-            }
-        }
-        if (indiceMin != i) {
-            swap(arr[i], arr[indiceMin]);
-        }
-    }
-}
+    // Las entradas de la celda siguiente se generan en otro núcleo mientras se mide la actual
+    TuberiaEntradas<vector<int>> entradas(generadoresPorTamano<vector<int>>(tamanios, {generarMejorCaso, generarPeorCaso, [](int n) { return generarCasoPromedio(n); }}));
 
-// Generar el mejor caso (ya ordenado)
-vector<int> generarMejorCaso(int n) {
-    vector<int> arr(n);
-    for (int i = 0; i < n; i++) {
-        arr[i] = i;
-    }
-    return arr;
-}
+    for (int n : tamanios) {
+        // Mejor caso
+        const vector<int>& mejorCaso = entradas.siguiente();
+        tiemposMejorCaso.push_back(medirCelda([&] { return mejorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Mejor caso", n, tiemposMejorCaso.back());
+        if (!publicar(0, n, tiemposMejorCaso.back())) return;
 
-// Generar el peor caso (orden inverso)
-vector<int> generarPeorCaso(int n) {
-    vector<int> arr(n);
-    for (int i = 0; i < n; i++) {
-        arr[i] = n - i;
-    }
-    return arr;
-}
+        // Peor caso
+        const vector<int>& peorCaso = entradas.siguiente();
+        tiemposPeorCaso.push_back(medirCelda([&] { return peorCaso; }, ordenar, configuracion));
+        imprimirCelda(cout, "Peor caso", n, tiemposPeorCaso.back());
+        if (!publicar(1, n, tiemposPeorCaso.back())) return;
 
-// Generar el caso promedio (aleatorio)
-vector<int> generarCasoPromedio(int n) {
-    vector<int> arr(n);
-    for (int i = 0; i < n; i++) {
-        arr[i] = i;
+        // Caso promedio
+        const vector<int>& casoPromedio = entradas.siguiente();
+        tiemposPromedio.push_back(medirCelda([&] { return casoPromedio; }, ordenar, configuracion));
+        imprimirCelda(cout, "Caso promedio", n, tiemposPromedio.back());
+        if (!publicar(2, n, tiemposPromedio.back())) return;
     }
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(arr.begin(), arr.end(), g);
-    return arr;
 }
 
-// Función para realizar pruebas de rendimiento
-void ejecutarPruebas(const vector<int>& tamanios, vector<long long>& tiemposMejorCaso, vector<long long>& tiemposPeorCaso, vector<long long>& tiemposPromedio) {
+// Pasada sin cronómetro con la instanciación que cuenta operaciones; la medición de tiempo
+// usa la instanciación por defecto (ConteoNulo), que no contiene contadores
+void contarOperacionesPorCaso(const vector<int>& tamanios, vector<Operaciones>& operacionesMejorCaso, vector<Operaciones>& operacionesPeorCaso, vector<Operaciones>& operacionesPromedio) {
     for (int n : tamanios) {
-        // Mejor caso
         vector<int> mejorCaso = generarMejorCaso(n);
-        long long inicio = obtenerTiempoSistemaNano();
-        ordenamientoPorSeleccion(mejorCaso);
-        long long fin = obtenerTiempoSistemaNano();
-        tiemposMejorCaso.push_back(fin - inicio);
+        operacionesMejorCaso.push_back(contarOperaciones([&] { ordenamientoPorSeleccion<ConteoOperaciones>(mejorCaso); }));
+        imprimirOperaciones(cout, "Mejor caso", n, operacionesMejorCaso.back());
 
-        // Peor caso
         vector<int> peorCaso = generarPeorCaso(n);
-        inicio = obtenerTiempoSistemaNano();
-        ordenamientoPorSeleccion(peorCaso);
-        fin = obtenerTiempoSistemaNano();
-        tiemposPeorCaso.push_back(fin - inicio);
+        operacionesPeorCaso.push_back(contarOperaciones([&] { ordenamientoPorSeleccion<ConteoOperaciones>(peorCaso); }));
+        imprimirOperaciones(cout, "Peor caso", n, operacionesPeorCaso.back());
 
-        // Caso promedio
         vector<int> casoPromedio = generarCasoPromedio(n);
-        inicio = obtenerTiempoSistemaNano();
-        ordenamientoPorSeleccion(casoPromedio);
-        fin = obtenerTiempoSistemaNano();
-        tiemposPromedio.push_back(fin - inicio);
+        operacionesPromedio.push_back(contarOperaciones([&] { ordenamientoPorSeleccion<ConteoOperaciones>(casoPromedio); }));
+        imprimirOperaciones(cout, "Caso promedio", n, operacionesPromedio.back());
     }
 }
 
 // Función para graficar resultados del benchmark
-void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanios, const vector<long long>& tiemposMejorCaso, const vector<long long>& tiemposPeorCaso, const vector<long long>& tiemposPromedio) {
+void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanios, const vector<EstadisticasCelda>& tiemposMejorCaso, const vector<EstadisticasCelda>& tiemposPeorCaso, const vector<EstadisticasCelda>& tiemposPromedio) {
     QVector<double> x(tamanios.size()), yMejor(tamanios.size()), yPeor(tamanios.size()), yPromedio(tamanios.size());
 
     // Llenar datos
     for (size_t i = 0; i < tamanios.size(); ++i) {
         x[i] = tamanios[i];
-        yMejor[i] = tiemposMejorCaso[i] + 10000000; // Elevar línea con valor constante
-        yPeor[i] = tiemposPeorCaso[i];
-        yPromedio[i] = tiemposPromedio[i];
+        yMejor[i] = tiemposMejorCaso[i].mediana;
+        yPeor[i] = tiemposPeorCaso[i].mediana;
+        yPromedio[i] = tiemposPromedio[i].mediana;
     }
 
     // Graficar mejor caso
@@ -118,13 +94,23 @@ void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanios, const
     grafico->graph(2)->setPen(QPen(Qt::green));
     grafico->graph(2)->setName("Caso Promedio O(n^2)");
 
+    // Dispersión de las repeticiones (percentiles 5 a 95)
+    agregarDispersion(grafico, grafico->graph(0), tiemposMejorCaso);
+    agregarDispersion(grafico, grafico->graph(1), tiemposPeorCaso);
+    agregarDispersion(grafico, grafico->graph(2), tiemposPromedio);
+
+    // Curvas del mejor modelo ajustado por mínimos cuadrados a las medianas
+    agregarAjuste(grafico, grafico->graph(0), "Mejor Caso", tamanios, ajustarComplejidad(tamanios, tiemposMejorCaso));
+    agregarAjuste(grafico, grafico->graph(1), "Peor Caso", tamanios, ajustarComplejidad(tamanios, tiemposPeorCaso));
+    agregarAjuste(grafico, grafico->graph(2), "Caso Promedio", tamanios, ajustarComplejidad(tamanios, tiemposPromedio));
+
     // Etiquetas y rango de ejes
     grafico->xAxis->setLabel("Tamaño de entrada (n)");
     grafico->yAxis->setLabel("Tiempo (nanosegundos)");
 
     // Ajustar los rangos
     grafico->xAxis->setRange(0, tamanios.back());
-    grafico->yAxis->setRange(0, *max_element(yPeor.begin(), yPeor.end()) + 100);
+    grafico->yAxis->setRange(0, maximoConDispersion(tiemposPeorCaso) + 100);
 
     // Mostrar leyenda
     grafico->legend->setVisible(true);
@@ -133,75 +119,53 @@ void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanios, const
     grafico->replot();
 }
 
-// Función para graficar la complejidad teórica
-void graficarComportamientoTeorico(QCustomPlot* graficoTeorico, const vector<int>& tamanios) {
-    QVector<double> x(tamanios.size()), yMejor(tamanios.size()), yPeor(tamanios.size()), yPromedio(tamanios.size());
-
-    // Complejidad teórica O(n^2)
-    for (size_t i = 0; i < tamanios.size(); ++i) {
-        x[i] = tamanios[i];
-        yMejor[i] = pow(tamanios[i], 2);
-        yPeor[i] = pow(tamanios[i], 2);
-        yPromedio[i] = pow(tamanios[i], 2);
-    }
-
-    // Graficar mejor caso
-    graficoTeorico->addGraph();
-    graficoTeorico->graph(0)->setData(x, yMejor);
-    graficoTeorico->graph(0)->setPen(QPen(Qt::blue, 2));
-    graficoTeorico->graph(0)->setName("Mejor Caso (Teórico) O(n^2)");
-
-    // Graficar peor caso
-    graficoTeorico->addGraph();
-    graficoTeorico->graph(1)->setData(x, yPeor);
-    graficoTeorico->graph(1)->setPen(QPen(Qt::red, 2));
-    graficoTeorico->graph(1)->setName("Peor Caso (Teórico) O(n^2)");
-
-    // Graficar caso promedio
-    graficoTeorico->addGraph();
-    graficoTeorico->graph(2)->setData(x, yPromedio);
-    graficoTeorico->graph(2)->setPen(QPen(Qt::green, 2));
-    graficoTeorico->graph(2)->setName("Caso Promedio (Teórico) O(n^2)");
-
-    // Etiquetas y rango de ejes
-    graficoTeorico->xAxis->setLabel("Tamaño de entrada (n)");
-    graficoTeorico->yAxis->setLabel("Operaciones");
-
-    // Ajustar los rangos
-    graficoTeorico->xAxis->setRange(0, tamanios.back());
-    graficoTeorico->yAxis->setRange(0, pow(tamanios.back(), 2));
-
-    // Mostrar leyenda
-    graficoTeorico->legend->setVisible(true);
-
-    // Reploteo final
-    graficoTeorico->replot();
+// Graficar las operaciones contadas de cada caso (en lugar de fórmulas escritas a mano)
+void graficarOperacionesContadas(QCustomPlot* grafico, const vector<int>& tamanios, const vector<Operaciones>& operacionesMejorCaso, const vector<Operaciones>& operacionesPeorCaso, const vector<Operaciones>& operacionesPromedio) {
+    graficarOperaciones(grafico, tamanios, {
+        {"Mejor Caso O(n^2)", Qt::blue, operacionesMejorCaso},
+        {"Peor Caso O(n^2)", Qt::red, operacionesPeorCaso},
+        {"Caso Promedio O(n^2)", Qt::darkGreen, operacionesPromedio},
+    });
 }
 
 int main(int argc, char *argv[]) {
     // Realizar las pruebas de rendimiento
-    vector<int> tamanios = {100, 1000, 5000, 10000, 50000};
-    vector<long long> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
-
-    ejecutarPruebas(tamanios, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    vector<int> tamanios = tamanosDeArgumentos(argc, argv, {100, 1000, 5000, 10000, 50000});
+    vector<EstadisticasCelda> tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio;
+    vector<Operaciones> operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio;
 
-    // Crear la aplicación y las gráficas
+    // Crear la aplicación y las gráficas antes de medir; los puntos aparecen a medida que se miden
     QApplication aplicacion(argc, argv);
 
-    // Gráfica de resultados de benchmark
-    QCustomPlot graficoResultados;
-    graficoResultados.legend->setVisible(true);
-    graficarResultados(&graficoResultados, tamanios, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+    QCustomPlot graficoResultados, graficoOperaciones, graficoContadores;
+    MedicionEnVivo enVivo(&graficoResultados, {{"Mejor Caso O(n^2)", Qt::blue}, {"Peor Caso O(n^2)", Qt::red}, {"Caso Promedio O(n^2)", Qt::green}});
     graficoResultados.resize(800, 600);
     graficoResultados.show();
 
-    // Gráfica de comportamiento teórico
-    QCustomPlot graficoTeorico;
-    graficoTeorico.legend->setVisible(true);
-    graficarComportamientoTeorico(&graficoTeorico, tamanios);
-    graficoTeorico.resize(800, 600);
-    graficoTeorico.show();
+    enVivo.iniciar([&] {
+        ejecutarPruebas(tamanios, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio, enVivo.publicador());
+        if (!enVivo.cancelada()) contarOperacionesPorCaso(tamanios, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+    }, [&] {
+        // Modelo de complejidad que mejor explica los tiempos medidos
+        imprimirAjuste(cout, "mejor caso", ajustarComplejidad(tamanios, tiemposMejorCaso));
+        imprimirAjuste(cout, "peor caso", ajustarComplejidad(tamanios, tiemposPeorCaso));
+        imprimirAjuste(cout, "caso promedio", ajustarComplejidad(tamanios, tiemposPromedio));
+
+        // Gráfica de resultados de benchmark, ahora con dispersión y ajustes
+        graficoResultados.clearPlottables();
+        graficarResultados(&graficoResultados, tamanios, tiemposMejorCaso, tiemposPeorCaso, tiemposPromedio);
+
+        // Gráfica de operaciones contadas (comparaciones, intercambios, ...)
+        graficarOperacionesContadas(&graficoOperaciones, tamanios, operacionesMejorCaso, operacionesPeorCaso, operacionesPromedio);
+        graficoOperaciones.resize(800, 600);
+        graficoOperaciones.show();
+
+        // Gráfica de contadores de hardware del caso promedio (solo si el sistema los permite)
+        if (graficarContadores(&graficoContadores, tamanios, tiemposPromedio)) {
+            graficoContadores.resize(800, 600);
+            graficoContadores.show();
+        }
+    });
 
     return aplicacion.exec();
 }
-
@@ -4,103 +4,83 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <algorithm> // Para std::shuffle
-#include <random>    // Para std::random_device y std::mt19937
 #include <cmath>     // Para funciones matemáticas
 #include <list>      // Para std::list
+#include "GraficasArnes.h" // Arnés de repeticiones y barras de dispersión
+#include "GraficaEnVivo.h" // Benchmarks en un hilo de trabajo con gráfica en vivo
+#include "GanchosMemoria.h" // Reservas y bytes de cada repetición
+#include "ListaOrdenada.h" // Búsqueda y generadores de los casos
+#include "ConfiguracionBarrido.h" // Tamaños desde --barrido / --tamanos
+#include "TuberiaEntradas.h" // Listas armadas en otro núcleo durante la medición
 
 using namespace std;
 using namespace std::chrono;
 
-// Función para obtener el tiempo actual en nanosegundos
-long long obtenerTiempoActualEnNano() {
-    return duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
-}
-
-// Algoritmo para buscar en una lista enlazada ordenada
-bool buscarEnListaOrdenada(const list<int>& lista, int valor) {
-    for (const auto& elemento : lista) {
-        if (elemento == valor) {
-            return true;
-        }
-        if (elemento > valor) {
-            break; // La lista está ordenada, no es necesario continuar
-        }
-    }
-    return false;
-}
+// Función para realizar los benchmarks y almacenar los resultados
+// La búsqueda no modifica la lista, así que el arnés reutiliza la misma en cada repetición
+// Cada celda se publica para la gráfica en vivo en cuanto se mide; si se cerró la ventana se deja de medir
+void ejecutarPruebas(const vector<int>& tamanos, vector<EstadisticasCelda>& tiemposMejorCaso, vector<EstadisticasCelda>& tiemposPeorCaso, vector<EstadisticasCelda>& tiemposCasoPromedio, const PublicarCelda& publicar) {
+    ConfiguracionArnes configuracion;
+    auto medirBusqueda = [&](const list<int>& lista, int valorBusqueda) {
+        return medirCelda([&]() -> const list<int>& { return lista; },
+                          [valorBusqueda](const list<int>& datos) { evitarOptimizacion(buscarEnListaOrdenada(datos, valorBusqueda)); },
+                          configuracion);
+    };
+
+    // Las listas de la celda siguiente se arman en otro núcleo mientras se mide la actual
+    TuberiaEntradas<list<int>> entradas(generadoresPorTamano<list<int>>(tamanos, {generarListaOrdenada, generarListaPeorCaso, [](int n) { return generarListaCasoPromedio(n); }}));
 
-// Genera una lista ordenada (Mejor caso)
-list<int> generarListaOrdenada(int n) {
-    list<int> lista;
-    for (int i = 0; i < n; ++i) {
-        lista.push_back(i);
-    }
-    return lista;
-}
+    for (int tam : tamanos) {
+        // Mejor caso
+        const list<int>& listaOrdenada = entradas.siguiente();
+        int valorBusqueda = 0; // El valor 0 siempre está presente en la lista
+        tiemposMejorCaso.push_back(medirBusqueda(listaOrdenada, valorBusqueda));
+        imprimirCelda(cout, "Mejor caso", tam, tiemposMejorCaso.back());
+        if (!publicar(0, tam, tiemposMejorCaso.back())) return;
 
-// Genera una lista en orden inverso (Peor caso)
-list<int> generarListaPeorCaso(int n) {
-    list<int> lista;
-    for (int i = n - 1; i >= 0; --i) {
-        lista.push_back(i);
-    }
-    return lista;
-}
+        // Peor caso
+        const list<int>& listaPeorCaso = entradas.siguiente();
+        valorBusqueda = tam; // El valor tam no está en la lista
+        tiemposPeorCaso.push_back(medirBusqueda(listaPeorCaso, valorBusqueda));
+        imprimirCelda(cout, "Peor caso", tam, tiemposPeorCaso.back());
+        if (!publicar(1, tam, tiemposPeorCaso.back())) return;
 
-// Genera una lista aleatoria (Caso promedio)
-list<int> generarListaCasoPromedio(int n) {
-    vector<int> vectorTemp(n);
-    for (int i = 0; i < n; ++i) {
-        vectorTemp[i] = i;
+        // Caso promedio
+        const list<int>& listaCasoPromedio = entradas.siguiente();
+        valorBusqueda = tam / 2; // Valor intermedio para el caso promedio
+        tiemposCasoPromedio.push_back(medirBusqueda(listaCasoPromedio, valorBusqueda));
+        imprimirCelda(cout, "Caso promedio", tam, tiemposCasoPromedio.back());
+        if (!publicar(2, tam, tiemposCasoPromedio.back())) return;
     }
-    random_device dispositivo;
-    mt19937 generador(dispositivo());
-    shuffle(vectorTemp.begin(), vectorTemp.end(), generador);
-
-    list<int> lista(vectorTemp.begin(), vectorTemp.end());
-    return lista;
 }
 
-// Función para realizar los benchmarks y almacenar los resultados
-void ejecutarPruebas(const vector<int>& tamanos, vector<long long>& tiemposMejorCaso, vector<long long>& tiemposPeorCaso, vector<long long>& tiemposCasoPromedio) {
+// Pasada sin cronómetro con la instanciación que cuenta operaciones, con las mismas listas y valores
+void contarOperacionesPorCaso(const vector<int>& tamanos, vector<Operaciones>& operacionesMejorCaso, vector<Operaciones>& operacionesPeorCaso, vector<Operaciones>& operacionesCasoPromedio) {
     for (int tam : tamanos) {
-        // Mejor caso
         list<int> listaOrdenada = generarListaOrdenada(tam);
-        int valorBusqueda = 0; // El valor 0 siempre está presente en la lista
-        long long inicio = obtenerTiempoActualEnNano();
-        buscarEnListaOrdenada(listaOrdenada, valorBusqueda);
-        long long fin = obtenerTiempoActualEnNano();
-        tiemposMejorCaso.push_back(fin - inicio);
+        operacionesMejorCaso.push_back(contarOperaciones([&] { buscarEnListaOrdenada<ConteoOperaciones>(listaOrdenada, 0); }));
+        imprimirOperaciones(cout, "Mejor caso", tam, operacionesMejorCaso.back());
 
-        // Peor caso
         list<int> listaPeorCaso = generarListaPeorCaso(tam);
-        valorBusqueda = tam; // El valor tam no está en la lista
-        inicio = obtenerTiempoActualEnNano();
-        buscarEnListaOrdenada(listaPeorCaso, valorBusqueda);
-        fin = obtenerTiempoActualEnNano();
-        tiemposPeorCaso.push_back(fin - inicio);
+        operacionesPeorCaso.push_back(contarOperaciones([&] { buscarEnListaOrdenada<ConteoOperaciones>(listaPeorCaso, tam); }));
+        imprimirOperaciones(cout, "Peor caso", tam, operacionesPeorCaso.back());
 
-        // Caso promedio
         list<int> listaCasoPromedio = generarListaCasoPromedio(tam);
-        valorBusqueda = tam / 2; // Valor intermedio para el caso promedio
-        inicio = obtenerTiempoActualEnNano();
-        buscarEnListaOrdenada(listaCasoPromedio, valorBusqueda);
-        fin = obtenerTiempoActualEnNano();
-        tiemposCasoPromedio.push_back(fin - inicio);
+        operacionesCasoPromedio.push_back(contarOperaciones([&] { buscarEnListaOrdenada<ConteoOperaciones>(listaCasoPromedio, tam / 2); }));
+        imprimirOperaciones(cout, "Caso promedio", tam, operacionesCasoPromedio.back());
     }
 }
 
 // Gráfico de resultados del benchmark
-void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const vector<long long>& tiemposMejorCaso, const vector<long long>& tiemposPeorCaso, const vector<long long>& tiemposCasoPromedio) {
+void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const vector<EstadisticasCelda>& tiemposMejorCaso, const vector<EstadisticasCelda>& tiemposPeorCaso, const vector<EstadisticasCelda>& tiemposCasoPromedio) {
     QVector<double> x(tamanos.size()), yMejor(tamanos.size()), yPeor(tamanos.size()), yPromedio(tamanos.size());
 
     // Llenar los datos
     for (size_t i = 0; i < tamanos.size(); ++i) {
         x[i] = tamanos[i];
-        yMejor[i] = tiemposMejorCaso[i] + 1000; // Añadir un valor constante para elevar la línea
-        yPeor[i] = tiemposPeorCaso[i];
-        yPromedio[i] = tiemposCasoPromedio[i];
+        yMejor[i] = tiemposMejorCaso[i].mediana;
+        yPeor[i] = tiemposPeorCaso[i].mediana;
+        yPromedio[i] = tiemposCasoPromedio[i].mediana;
     }
 
     // Graficar mejor caso
@@ -121,13 +101,23 @@ void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const
     grafico->graph(2)->setPen(QPen(Qt::green));
     grafico->graph(2)->setName("Caso Promedio O(n)");
 
+    // Dispersión de las repeticiones (percentiles 5 a 95)
+    agregarDispersion(grafico, grafico->graph(0), tiemposMejorCaso);
+    agregarDispersion(grafico, grafico->graph(1), tiemposPeorCaso);
+    agregarDispersion(grafico, grafico->graph(2), tiemposCasoPromedio);
+
+    // Curvas del mejor modelo ajustado por mínimos cuadrados a las medianas
+    agregarAjuste(grafico, grafico->graph(0), "Mejor Caso", tamanos, ajustarComplejidad(tamanos, tiemposMejorCaso));
+    agregarAjuste(grafico, grafico->graph(1), "Peor Caso", tamanos, ajustarComplejidad(tamanos, tiemposPeorCaso));
+    agregarAjuste(grafico, grafico->graph(2), "Caso Promedio", tamanos, ajustarComplejidad(tamanos, tiemposCasoPromedio));
+
     // Ajustar etiquetas y rango de ejes
     grafico->xAxis->setLabel("Tamaño de entrada (n)");
     grafico->yAxis->setLabel("Tiempo (nanosegundos)");
 
     // Ajustar los rangos
     grafico->xAxis->setRange(0, tamanos.back());
-    grafico->yAxis->setRange(0, *max_element(yPeor.begin(), yPeor.end()) + 100);  // Ajustar el rango del eje Y
+    grafico->yAxis->setRange(0, maximoConDispersion(tiemposPeorCaso) + 100);  // Ajustar el rango del eje Y
 
     // Mostrar leyenda
     grafico->legend->setVisible(true);
@@ -136,74 +126,62 @@ void graficarResultados(QCustomPlot* grafico, const vector<int>& tamanos, const
     grafico->replot();
 }
 
-// Gráfico de comportamiento teórico
-void graficarComportamientoTeorico(QCustomPlot* grafico, const vector<int>& tamanos) {
-    QVector<double> x(tamanos.size()), yMejor(tamanos.size()), yPeor(tamanos.size()), yPromedio(tamanos.size());
-
-    // Llenar los datos con la complejidad teórica
-    for (size_t i = 0; i < tamanos.size(); ++i) {
-        x[i] = tamanos[i];
-        yMejor[i] = 1;               // O(1)
-        yPeor[i] = tamanos[i];        // O(n)
-        yPromedio[i] = tamanos[i];    // O(n) caso promedio
-    }
-
-    // Graficar mejor caso
-    grafico->addGraph();
-    grafico->graph(0)->setData(x, yMejor);
-    grafico->graph(0)->setPen(QPen(Qt::blue, 2));
-    grafico->graph(0)->setName("Mejor Caso (Teórico) O(1)");
-
-    // Graficar peor caso
-    grafico->addGraph();
-    grafico->graph(1)->setData(x, yPeor);
-    grafico->graph(1)->setPen(QPen(Qt::red, 2));
-    grafico->graph(1)->setName("Peor Caso (Teórico) O(n)");
-
-    // Graficar caso promedio
-    grafico->addGraph();
-    grafico->graph(2)->setData(x, yPromedio);
-    grafico->graph(2)->setPen(QPen(Qt::green, 2));
-    grafico->graph(2)->setName("Caso Promedio (Teórico) O(n)");
-
-    // Ajustar etiquetas y rango de ejes
-    grafico->xAxis->setLabel("Tamaño de entrada (n)");
-    grafico->yAxis->setLabel("Operaciones");
-
-    // Ajustar los rangos
-    grafico->xAxis->setRange(0, tamanos.back());
-    grafico->yAxis->setRange(0, tamanos.back());  // Ajustar el rango del eje Y
-
-    // Mostrar leyenda
-    grafico->legend->setVisible(true);
-
-    // Reploteo final
-    grafico->replot();
+// Gráfico de las operaciones contadas de cada caso (en lugar de fórmulas escritas a mano)
+void graficarOperacionesContadas(QCustomPlot* grafico, const vector<int>& tamanos, const vector<Operaciones>& operacionesMejorCaso, const vector<Operaciones>& operacionesPeorCaso, const vector<Operaciones>& operacionesCasoPromedio) {
+    graficarOperaciones(grafico, tamanos, {
+        {"Mejor Caso O(1)", Qt::blue, operacionesMejorCaso},
+        {"Peor Caso O(n)", Qt::red, operacionesPeorCaso},
+        {"Caso Promedio O(n)", Qt::darkGreen, operacionesCasoPromedio},
+    });
 }
 
 int main(int argc, char *argv[]) {
-    // Realizar los benchmarks
-    vector<int> tamanosEntrada = {100, 1000, 5000, 10000, 50000}; // Tamaños de entrada
-    vector<long long> tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio;
+    vector<int> tamanosEntrada = tamanosDeArgumentos(argc, argv, {100, 1000, 5000, 10000, 50000}); // Tamaños de entrada
+    vector<EstadisticasCelda> tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio;
+    vector<Operaciones> operacionesMejorCaso, operacionesPeorCaso, operacionesCasoPromedio;
 
-    ejecutarPruebas(tamanosEntrada, tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio);
+    // La búsqueda del mejor caso dura pocos ns: el arnés la mide en lotes con el reloj de ciclos
+    cout << "Reloj: " << relojCiclos().describir() << endl;
 
-    // Crear la aplicación Qt
+    // Crear la aplicación Qt antes de medir, para ver cada punto en cuanto se mide
     QApplication aplicacion(argc, argv);
 
-    // Gráfica de resultados del benchmark
-    QCustomPlot graficoResultados;
-    graficoResultados.legend->setVisible(true);
-    graficarResultados(&graficoResultados, tamanosEntrada, tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio);
+    QCustomPlot graficoResultados, graficoOperaciones, graficoContadores, graficoMemoria;
+    MedicionEnVivo enVivo(&graficoResultados, {{"Mejor Caso O(1)", Qt::blue}, {"Peor Caso O(n)", Qt::red}, {"Caso Promedio O(n)", Qt::green}});
     graficoResultados.resize(800, 600);
     graficoResultados.show();
 
-    // Gráfica de comportamiento teórico
-    QCustomPlot graficoTeorico;
-    graficoTeorico.legend->setVisible(true);
-    graficarComportamientoTeorico(&graficoTeorico, tamanosEntrada);
-    graficoTeorico.resize(800, 600);
-    graficoTeorico.show();
+    // Realizar los benchmarks y el conteo de operaciones en el hilo de trabajo
+    enVivo.iniciar([&] {
+        ejecutarPruebas(tamanosEntrada, tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio, enVivo.publicador());
+        if (!enVivo.cancelada()) contarOperacionesPorCaso(tamanosEntrada, operacionesMejorCaso, operacionesPeorCaso, operacionesCasoPromedio);
+    }, [&] {
+        // Modelo de complejidad que mejor explica los tiempos medidos
+        imprimirAjuste(cout, "mejor caso", ajustarComplejidad(tamanosEntrada, tiemposMejorCaso));
+        imprimirAjuste(cout, "peor caso", ajustarComplejidad(tamanosEntrada, tiemposPeorCaso));
+        imprimirAjuste(cout, "caso promedio", ajustarComplejidad(tamanosEntrada, tiemposCasoPromedio));
+
+        // Gráfica de resultados del benchmark, ahora con dispersión y ajustes
+        graficoResultados.clearPlottables();
+        graficarResultados(&graficoResultados, tamanosEntrada, tiemposMejorCaso, tiemposPeorCaso, tiemposCasoPromedio);
+
+        // Gráfica de operaciones contadas (visitas y comparaciones)
+        graficarOperacionesContadas(&graficoOperaciones, tamanosEntrada, operacionesMejorCaso, operacionesPeorCaso, operacionesCasoPromedio);
+        graficoOperaciones.resize(800, 600);
+        graficoOperaciones.show();
+
+        // Gráfica de contadores de hardware del caso promedio (solo si el sistema los permite)
+        if (graficarContadores(&graficoContadores, tamanosEntrada, tiemposCasoPromedio)) {
+            graficoContadores.resize(800, 600);
+            graficoContadores.show();
+        }
+
+        // Gráfica de memoria por elemento de los tres casos (reservas, bytes, picos y fallos de página)
+        if (graficarMemoria(&graficoMemoria, tamanosEntrada, {{"Mejor Caso", Qt::blue, tiemposMejorCaso}, {"Peor Caso", Qt::red, tiemposPeorCaso}, {"Caso Promedio", Qt::darkGreen, tiemposCasoPromedio}})) {
+            graficoMemoria.resize(800, 600);
+            graficoMemoria.show();
+        }
+    });
 
     return aplicacion.exec();
 }
@@ -0,0 +1,161 @@
+#ifndef TRAZAS_H
+#define TRAZAS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "RelojCiclos.h"
+
+// Zonas de traza para ver en qué se va el tiempo dentro de una celda o de un replot. Cada
+// zona guarda al cerrarse su nombre y las marcas del contador de ciclos de inicio y fin en un
+// búfer circular del hilo (sin candados: solo lo escribe su hilo), y exportarTrazaChrome los
+// vuelca en el formato JSON de Chrome/Perfetto (chrome://tracing, ui.perfetto.dev).
+//
+// Las macros solo generan código si se compila con TRAZAS_ACTIVAS (opción TRAZAS de CMake);
+// sin ella ZONA_TRAZA no cuesta nada y la exportación escribe una traza vacía. Los nombres
+// deben vivir todo el programa (literales o nombres de clase de Qt), porque se guarda el
+// puntero. La exportación lee los búferes sin sincronizar: llamarla cuando los hilos que
+// trazan terminaron o están quietos.
+
+#ifdef TRAZAS_ACTIVAS
+inline constexpr bool trazasCompiladas = true;
+#else
+inline constexpr bool trazasCompiladas = false;
+#endif
+
+struct EventoTraza {
+    const char* nombre;
+    uint64_t inicio, fin; // Marcas de RelojCiclos::marcaRapida
+};
+
+// Búfer circular de un hilo; al llenarse se pisan los eventos más viejos
+class BufferTraza {
+public:
+    static constexpr size_t capacidad = 1 << 16;
+
+    explicit BufferTraza(int hilo) : eventos(capacidad), hilo(hilo) {}
+
+    void registrar(const char* nombre, uint64_t inicio, uint64_t fin) {
+        eventos[escritos % capacidad] = {nombre, inicio, fin};
+        escritos++;
+    }
+
+    // Eventos guardados, del más viejo al más nuevo
+    std::vector<EventoTraza> copiar() const {
+        std::vector<EventoTraza> copia;
+        size_t desde = escritos > capacidad ? escritos - capacidad : 0;
+        for (size_t i = desde; i < escritos; i++) copia.push_back(eventos[i % capacidad]);
+        return copia;
+    }
+
+    int numeroHilo() const { return hilo; }
+    size_t perdidos() const { return escritos > capacidad ? escritos - capacidad : 0; }
+
+private:
+    std::vector<EventoTraza> eventos;
+    size_t escritos = 0;
+    int hilo;
+};
+
+// Todos los búferes creados; el registro los mantiene vivos después de que su hilo termina
+struct RegistroTrazas {
+    std::mutex candado;
+    std::vector<std::shared_ptr<BufferTraza>> buferes;
+};
+
+inline RegistroTrazas& registroTrazas() {
+    static RegistroTrazas registro;
+    return registro;
+}
+
+inline BufferTraza& bufferTrazaHilo() {
+    thread_local std::shared_ptr<BufferTraza> buffer = [] {
+        RegistroTrazas& registro = registroTrazas();
+        std::lock_guard<std::mutex> candado(registro.candado);
+        registro.buferes.push_back(std::make_shared<BufferTraza>(static_cast<int>(registro.buferes.size()) + 1));
+        return registro.buferes.back();
+    }();
+    return *buffer;
+}
+
+// Zona activa desde su construcción hasta el final del bloque
+class ZonaTraza {
+public:
+    explicit ZonaTraza(const char* nombre) : buffer(bufferTrazaHilo()), nombre(nombre), inicio(relojCiclos().marcaRapida()) {}
+    ~ZonaTraza() { buffer.registrar(nombre, inicio, relojCiclos().marcaRapida()); }
+
+    ZonaTraza(const ZonaTraza&) = delete;
+    ZonaTraza& operator=(const ZonaTraza&) = delete;
+
+private:
+    BufferTraza& buffer;
+    const char* nombre;
+    uint64_t inicio;
+};
+
+#ifdef TRAZAS_ACTIVAS
+#define TRAZA_CONCATENAR_(a, b) a##b
+#define TRAZA_CONCATENAR(a, b) TRAZA_CONCATENAR_(a, b)
+#define ZONA_TRAZA(nombre) ZonaTraza TRAZA_CONCATENAR(zonaTraza_, __LINE__)(nombre)
+#else
+#define ZONA_TRAZA(nombre) static_cast<void>(0)
+#endif
+
+// Eventos completos ("ph":"X") en microsegundos desde el primer evento, un tid por hilo
+inline bool exportarTrazaChrome(const std::string& ruta) {
+    std::ofstream salida(ruta);
+    if (!salida) return false;
+
+    std::vector<std::shared_ptr<BufferTraza>> buferes;
+    {
+        RegistroTrazas& registro = registroTrazas();
+        std::lock_guard<std::mutex> candado(registro.candado);
+        buferes = registro.buferes;
+    }
+    std::vector<std::vector<EventoTraza>> eventos;
+    uint64_t origen = UINT64_MAX;
+    for (const auto& buffer : buferes) {
+        eventos.push_back(buffer->copiar());
+        for (const EventoTraza& evento : eventos.back()) origen = std::min(origen, evento.inicio);
+    }
+
+    const RelojCiclos& reloj = relojCiclos();
+    auto escribirNombre = [&](const char* nombre) {
+        salida << '"';
+        for (const char* c = nombre; *c; c++) {
+            if (*c == '"' || *c == '\\') salida << '\\';
+            salida << *c;
+        }
+        salida << '"';
+    };
+    salida << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool primero = true;
+    for (size_t b = 0; b < buferes.size(); b++) {
+        salida << (primero ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buferes[b]->numeroHilo()
+               << ",\"args\":{\"name\":\"hilo " << buferes[b]->numeroHilo() << "\"}}";
+        primero = false;
+        for (const EventoTraza& evento : eventos[b]) {
+            salida << ",\n{\"ph\":\"X\",\"name\":";
+            escribirNombre(evento.nombre);
+            salida << ",\"pid\":1,\"tid\":" << buferes[b]->numeroHilo() << ",\"ts\":" << reloj.aNs(evento.inicio - origen) / 1000
+                   << ",\"dur\":" << reloj.aNs(evento.fin - evento.inicio) / 1000 << "}";
+        }
+    }
+    salida << "\n]}\n";
+    return static_cast<bool>(salida);
+}
+
+// Para los mensajes: eventos pisados en los búferes circulares
+inline size_t eventosTrazaPerdidos() {
+    RegistroTrazas& registro = registroTrazas();
+    std::lock_guard<std::mutex> candado(registro.candado);
+    size_t perdidos = 0;
+    for (const auto& buffer : registro.buferes) perdidos += buffer->perdidos();
+    return perdidos;
+}
+
+#endif // TRAZAS_H
@@ -0,0 +1,133 @@
+#ifndef TUBERIAENTRADAS_H
+#define TUBERIAENTRADAS_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "PlanificadorCeldas.h"
+#include "Trazas.h"
+
+// Tubería de entradas para un barrido secuencial: un hilo generador prepara la entrada de la
+// celda siguiente mientras el hilo que mide cronometra la actual, con dos ranuras (doble
+// búfer), así generar (barajar n elementos, armar una lista) sale del camino crítico. El hilo
+// que mide queda fijado a una CPU aislada (isolcpus) si el proceso puede usar alguna, o al
+// último núcleo físico; el generador, y los hilos de generación que cree, a todas las demás
+// CPUs menos las de ese núcleo (ni el hermano SMT). La región medida sigue compartiendo la
+// L3 y el ancho de banda con el generador; con un solo núcleo no se crea el hilo y cada
+// entrada se genera en siguiente().
+
+template <class T>
+class TuberiaEntradas {
+public:
+    // generadores[i] arma la entrada de la celda i; se consumen en ese orden
+    explicit TuberiaEntradas(std::vector<std::function<T()>> generadores) : generadores(std::move(generadores)) {
+        std::vector<int> permitidas = cpusPermitidas();
+        std::vector<int> nucleos = elegirNucleos(true);
+        int cpu = nucleos.back();
+        for (int aislada : cpusAisladas()) {
+            if (std::find(permitidas.begin(), permitidas.end(), aislada) != permitidas.end()) {
+                cpu = aislada;
+                break;
+            }
+        }
+        std::vector<int> cpusGenerador;
+        for (int otra : permitidas) {
+            if (nucleoFisico(otra) != nucleoFisico(cpu)) cpusGenerador.push_back(otra);
+        }
+        if (cpusGenerador.empty()) return;
+
+        cpusOriginales = permitidas;
+        cpuMedicion = fijarHiloACpu(cpu);
+        productor = std::thread([this, cpusGenerador] {
+            fijarHiloACpus(cpusGenerador);
+            producir();
+        });
+    }
+
+    TuberiaEntradas(const TuberiaEntradas&) = delete;
+    TuberiaEntradas& operator=(const TuberiaEntradas&) = delete;
+
+    // Detiene el generador aunque queden celdas (por ejemplo, si se canceló el barrido) y
+    // devuelve el hilo que mide a sus CPUs de antes
+    ~TuberiaEntradas() {
+        {
+            std::lock_guard<std::mutex> candado(mutex);
+            cancelado = true;
+        }
+        cambio.notify_all();
+        if (productor.joinable()) productor.join();
+        if (cpuMedicion >= 0) fijarHiloACpus(cpusOriginales);
+    }
+
+    // Entrada de la celda siguiente; la referencia vale hasta la próxima llamada. Libera la
+    // ranura de la celda anterior para que el generador arme la que sigue
+    const T& siguiente() {
+        if (!productor.joinable()) {
+            ranuras[0] = generadores[consumidas++]();
+            return *ranuras[0];
+        }
+        ZONA_TRAZA("esperarEntrada");
+        std::unique_lock<std::mutex> candado(mutex);
+        if (consumidas > 0) ranuras[(consumidas - 1) % 2].reset();
+        cambio.notify_all();
+        cambio.wait(candado, [&] { return ranuras[consumidas % 2].has_value() || (error && celdaConError == consumidas); });
+        if (!ranuras[consumidas % 2].has_value()) std::rethrow_exception(error);
+        return *ranuras[consumidas++ % 2];
+    }
+
+    // CPU donde quedó el hilo que mide, o -1 si no se fijó
+    int cpu() const { return cpuMedicion; }
+
+private:
+    void producir() {
+        for (size_t i = 0; i < generadores.size(); i++) {
+            {
+                std::unique_lock<std::mutex> candado(mutex);
+                cambio.wait(candado, [&] { return cancelado || !ranuras[i % 2].has_value(); });
+                if (cancelado) return;
+            }
+            try {
+                T entrada = generadores[i]();
+                std::lock_guard<std::mutex> candado(mutex);
+                ranuras[i % 2] = std::move(entrada);
+            } catch (...) {
+                std::lock_guard<std::mutex> candado(mutex);
+                error = std::current_exception();
+                celdaConError = i;
+            }
+            cambio.notify_all();
+            if (error) return;
+        }
+    }
+
+    std::vector<std::function<T()>> generadores;
+    std::optional<T> ranuras[2]; // La celda i usa ranuras[i % 2]
+    size_t consumidas = 0;
+    bool cancelado = false;
+    std::exception_ptr error; // Excepción del generador, que se relanza en la celda que falló
+    size_t celdaConError = 0;
+    std::mutex mutex;
+    std::condition_variable cambio;
+    std::vector<int> cpusOriginales;
+    int cpuMedicion = -1;
+    std::thread productor;
+};
+
+// Generadores en el orden de ejecutarPruebas: para cada n, un generador por caso
+template <class T>
+std::vector<std::function<T()>> generadoresPorTamano(const std::vector<int>& tamanos, const std::vector<std::function<T(int)>>& casos) {
+    std::vector<std::function<T()>> generadores;
+    for (int n : tamanos) {
+        for (const auto& caso : casos) generadores.push_back([caso, n] { return caso(n); });
+    }
+    return generadores;
+}
+
+#endif // TUBERIAENTRADAS_H